@@ -33,6 +33,31 @@ namespace lsp
     {
         typedef struct ringmod_sc
         {
+            static constexpr float  HPF_MIN             = 10.0f;
+            static constexpr float  HPF_MAX             = 20000.0f;
+            static constexpr float  HPF_DFL             = 10.0f;
+            static constexpr float  HPF_STEP            = 0.0025f;
+
+            static constexpr float  LPF_MIN             = 10.0f;
+            static constexpr float  LPF_MAX             = 20000.0f;
+            static constexpr float  LPF_DFL             = 20000.0f;
+            static constexpr float  LPF_STEP            = 0.0025f;
+
+            static constexpr float  SPLIT1_MIN          = 20.0f;
+            static constexpr float  SPLIT1_MAX          = 20000.0f;
+            static constexpr float  SPLIT1_DFL          = 120.0f;
+            static constexpr float  SPLIT1_STEP         = 0.002f;
+
+            static constexpr float  SPLIT2_MIN          = 20.0f;
+            static constexpr float  SPLIT2_MAX          = 20000.0f;
+            static constexpr float  SPLIT2_DFL          = 1000.0f;
+            static constexpr float  SPLIT2_STEP         = 0.002f;
+
+            static constexpr float  SPLIT3_MIN          = 20.0f;
+            static constexpr float  SPLIT3_MAX          = 20000.0f;
+            static constexpr float  SPLIT3_DFL          = 6000.0f;
+            static constexpr float  SPLIT3_STEP         = 0.002f;
+
             static constexpr float  HOLD_MIN            = 0.0f;
             static constexpr float  HOLD_MAX            = 10.0f;
             static constexpr float  HOLD_DFL            = 0.0f;
@@ -43,6 +68,11 @@ namespace lsp
             static constexpr float  RELEASE_DFL         = 0.0f;
             static constexpr float  RELEASE_STEP        = 0.004f;
 
+            static constexpr float  DETECT_WINDOW_MIN   = 0.1f;
+            static constexpr float  DETECT_WINDOW_MAX   = 100.0f;
+            static constexpr float  DETECT_WINDOW_DFL   = 10.0f;
+            static constexpr float  DETECT_WINDOW_STEP  = 0.004f;
+
             static constexpr float  LOOKAHEAD_MIN       = 0.0f;
             static constexpr float  LOOKAHEAD_MAX       = 10.0f;
             static constexpr float  LOOKAHEAD_DFL       = 0.0f;
@@ -58,13 +88,23 @@ namespace lsp
             static constexpr float  AMOUNT_DFL          = 0.0f;
             static constexpr float  AMOUNT_STEP         = 0.01f;
 
+            static constexpr float  DSP_LOAD_MIN        = 0.0f;
+            static constexpr float  DSP_LOAD_MAX        = 100.0f;
+            static constexpr float  DSP_LOAD_DFL        = 0.0f;
+            static constexpr float  DSP_LOAD_STEP       = 0.1f;
+
+            static constexpr size_t LINKS_MAX           = 3;
+            static constexpr size_t BANDS_MAX           = 4;
             static constexpr size_t TIME_MESH_SIZE      = 640;
             static constexpr float  TIME_HISTORY_MAX    = 5.0f;
+            static constexpr float  REFRESH_RATE        = 60.0f;
         } ringmod_sc;
 
         // Plugin type metadata
         extern const plugin_t ringmod_sc_mono;
         extern const plugin_t ringmod_sc_stereo;
+        extern const plugin_t ringmod_sc_5_1;
+        extern const plugin_t ringmod_sc_7_1;
 
     } /* namespace meta */
 } /* namespace lsp */
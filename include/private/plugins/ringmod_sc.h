@@ -23,9 +23,13 @@
 #define PRIVATE_PLUGINS_RINGMOD_SC_H_
 
 #include <lsp-plug.in/dsp-units/ctl/Bypass.h>
+#include <lsp-plug.in/dsp-units/filters/Equalizer.h>
+#include <lsp-plug.in/dsp-units/util/Crossover.h>
 #include <lsp-plug.in/dsp-units/util/Delay.h>
 #include <lsp-plug.in/dsp-units/util/MeterGraph.h>
+#include <lsp-plug.in/dsp-units/util/Oversampler.h>
 #include <lsp-plug.in/dsp-units/util/RingBuffer.h>
+#include <lsp-plug.in/ipc/ITask.h>
 #include <lsp-plug.in/plug-fw/plug.h>
 #include <lsp-plug.in/plug-fw/core/IDBuffer.h>
 #include <private/meta/ringmod_sc.h>
@@ -45,6 +49,7 @@ namespace lsp
                     SC_TYPE_INTERNAL,
                     SC_TYPE_EXTERNAL,
                     SC_TYPE_SHM_LINK,
+                    SC_TYPE_ENVELOPE,
                 };
 
                 enum sc_source_t
@@ -61,6 +66,53 @@ namespace lsp
                     SC_SRC_MAX
                 };
 
+                enum lookahead_mode_t
+                {
+                    LK_MODE_TAPS,
+                    LK_MODE_WINDOW
+                };
+
+                enum detect_mode_t
+                {
+                    DET_MODE_PEAK,
+                    DET_MODE_RMS,
+                    DET_MODE_MEAN
+                };
+
+                enum link_mode_t
+                {
+                    LINK_MODE_SUM,
+                    LINK_MODE_MAX
+                };
+
+                enum premix_bus_t
+                {
+                    PM_IN,
+                    PM_SC,
+                    PM_LINK,
+
+                    PM_TOTAL
+                };
+
+                enum premix_op_t
+                {
+                    PM_OP_NONE,                             // Pass the original buffer
+                    PM_OP_MUL,                              // out = a*x
+                    PM_OP_MIX2,                             // out = a*x + b*y
+                    PM_OP_MIX3                              // out = a*x + b*y + c*z
+                };
+
+                enum profile_stage_t
+                {
+                    PS_PREMIX,                              // Pre-mix
+                    PS_SIDECHAIN,                           // Sidechain processing
+                    PS_APPLY,                               // Gain reduction and mixing
+                    PS_IDLE,                                // Idle state processing
+                    PS_OUTPUT,                              // Meters and meshes output
+
+                    PS_TOTAL
+                };
+
                 enum meter_graph_t
                 {
                     MG_IN,
@@ -71,6 +123,60 @@ namespace lsp
                     MG_TOTAL
                 };
 
+                typedef struct settings_request_t
+                {
+                    float               fSampleRate;            // Sample rate
+                    float               fHold;                  // Hold time
+                    float               fRelease;               // Release time
+                    float               fLookahead;             // Lookahead time
+                    float               fDuck;                  // Duck time
+                    float               fDetWindow;             // Detector window
+                    float               fAmount;                // Amount in decibels
+                    uint32_t            nType;                  // Sidechain type
+                    uint32_t            nHpfMode;               // High-pass filter mode
+                    uint32_t            nLpfMode;               // Low-pass filter mode
+                    float               fHpfFreq;               // High-pass filter frequency
+                    float               fLpfFreq;               // Low-pass filter frequency
+                    uint32_t            nBands;                 // Number of bands
+                    float               vSplit[meta::ringmod_sc::BANDS_MAX - 1]; // Split frequencies
+                    uint32_t            nOverMode;              // Oversampling mode
+                } settings_request_t;
+
+                typedef struct settings_t
+                {
+                    float               fTauRelease;            // Release time constant
+                    float               fAmount;                // Amount
+                    uint32_t            nHold;                  // Hold time in samples
+                    uint32_t            nLookahead;             // Lookahead in samples
+                    uint32_t            nDuck;                  // Ducking in samples
+                    uint32_t            nDetWindow;             // Detector window in samples
+                    uint32_t            nType;                  // Sidechain type
+                    uint32_t            nBands;                 // Number of bands
+                    uint32_t            nOverMode;              // Oversampling mode
+                    bool                bScFilter;              // Sidechain filters are enabled
+                    dspu::filter_params_t sHpf;                 // Sidechain high-pass filter
+                    dspu::filter_params_t sLpf;                 // Sidechain low-pass filter
+                    float               vSplit[meta::ringmod_sc::BANDS_MAX - 1]; // Split frequencies in ascending order
+                } settings_t;
+
+                class SettingsTask: public ipc::ITask
+                {
+                    private:
+                        ringmod_sc         *pCore;
+
+                    public:
+                        explicit SettingsTask(ringmod_sc *core);
+                        SettingsTask(const SettingsTask &) = delete;
+                        SettingsTask(SettingsTask &&) = delete;
+                        virtual ~SettingsTask() override;
+
+                        SettingsTask & operator = (const SettingsTask &) = delete;
+                        SettingsTask & operator = (SettingsTask &&) = delete;
+
+                    public:
+                        virtual status_t    run() override;
+                };
+
                 typedef struct io_buffers_t
                 {
                     float              *vIn;
@@ -78,8 +184,16 @@ namespace lsp
                     float              *vScIn;
                     float              *vShmIn;
                     float              *vMixSc;
+                    float              *vLinkIn;                // Combined shared memory links before pre-mix
                 } io_buffers_t;
 
+                typedef struct premix_route_t
+                {
+                    uint32_t            nOp;                    // Operation, see premix_op_t
+                    uint32_t            vSrc[PM_TOTAL];         // Source buses
+                    float               vGain[PM_TOTAL];        // Source gains
+                } premix_route_t;
+
                 typedef struct premix_t
                 {
                     float               fInToSc;                // Input -> Sidechain mix
@@ -89,14 +203,18 @@ namespace lsp
                     float               fScToIn;                // Sidechain -> Input mix
                     float               fScToLink;              // Sidechain -> Link mix
 
-                    float              *vIn[2];                 // Input buffer
-                    float              *vOut[2];                // Output buffer
-                    float              *vSc[2];                 // Sidechain buffer
-                    float              *vLink[2];               // Link buffer
+                    float             **vIn;                    // Input buffer
+                    float             **vOut;                   // Output buffer
+                    float             **vSc;                    // Sidechain buffer
+                    float             **vLink;                  // Active link buffers, LINKS_MAX per channel
+                    uint32_t           *vLinks;                 // Number of active link buffers for each channel
+
+                    float             **vTmpIn;                 // Replacement buffer for input
+                    float             **vTmpLink;               // Replacement buffer for link
+                    float             **vTmpSc;                 // Replacement buffer for sidechain
+                    float             **vTmpComb;               // Buffer for combined shared memory links
 
-                    float              *vTmpIn[2];              // Replacement buffer for input
-                    float              *vTmpLink[2];            // Replacement buffer for link
-                    float              *vTmpSc[2];              // Replacement buffer for sidechain
+                    premix_route_t      vRoutes[2][PM_TOTAL];   // Compiled routes without/with link for each bus
 
                     plug::IPort        *pInToSc;                // Input -> Sidechain mix
                     plug::IPort        *pInToLink;              // Input -> Link mix
@@ -106,59 +224,164 @@ namespace lsp
                     plug::IPort        *pScToLink;              // Sidechain -> Link mix
                 } premix_t;
 
+                typedef struct ramp_t
+                {
+                    float               fValue;                 // Value at the current processing position
+                    float               fTarget;                // Value to reach at the end of the block
+                    float               fDelta;                 // Increment per sample
+                } ramp_t;
+
+                typedef struct profile_t
+                {
+                    uint64_t            vTime[PS_TOTAL];        // Accumulated time of each stage in nanoseconds
+                    uint64_t            vPeak[PS_TOTAL];        // Maximum time of single call of each stage in nanoseconds
+                    uint64_t            vCalls[PS_TOTAL];       // Number of calls of each stage
+                    uint64_t            nLoadTime;              // Processing time since the last DSP load update in nanoseconds
+                    uint32_t            nLoadSamples;           // Number of samples processed since the last DSP load update
+                    float               fLoad;                  // DSP load in percents
+                } profile_t;
+
+                typedef struct window_max_t
+                {
+                    float              *vValue;                 // Values stored in the deque
+                    uint32_t           *vTime;                  // Timestamps of values stored in the deque
+                    uint32_t            nHead;                  // Head of the deque
+                    uint32_t            nCount;                 // Number of elements in the deque
+                    uint32_t            nMask;                  // Capacity mask of the deque
+                } window_max_t;
+
+                typedef struct detector_t
+                {
+                    float              *vHistory;               // Detected values within the window
+                    float               fSum;                   // Running sum of values within the window
+                    uint32_t            nHead;                  // Current position in the history
+                } detector_t;
+
+                typedef struct band_t
+                {
+                    dspu::RingBuffer    sEnvDelay;              // Sidechain envelope delay buffer
+                    window_max_t        sWndMax;                // Running maximum over the lookahead window
+                    detector_t          sDetector;              // Running RMS or mean detector
+                    float               fPeak;                  // Current sidechain peak value
+                    uint32_t            nHold;                  // Hold counter
+                    float              *vIn;                    // Input signal of the band
+                    float              *vEnv;                   // Sidechain signal, envelope, gain reduction of the band
+                } band_t;
+
                 typedef struct channel_t
                 {
                     // DSP processing modules
                     dspu::Bypass        sBypass;                // Bypass
                     dspu::Delay         sInDelay;               // Input signal delay
                     dspu::Delay         sScDelay;               // Sidechain input delay
+                    dspu::Equalizer     sScEq;                  // Sidechain high-pass and low-pass filters
                     dspu::RingBuffer    sEnvDelay;              // Sidechain envelope delay buffer
                     dspu::MeterGraph    vGraph[MG_TOTAL];       // Meter graphs
+                    window_max_t        sWndMax;                // Running maximum over the lookahead window
+                    detector_t          sDetector;              // Running RMS or mean detector
+                    dspu::Oversampler   sOverIn;                // Oversampler for the input signal and the modulated signal
+                    dspu::Oversampler   sOverGain;              // Oversampler for the gain reduction
+                    dspu::Delay         sOutDelay;              // Latency compensation for the output signal
+                    dspu::Delay         sDryDelay;              // Latency compensation for the dry signal
+                    dspu::Delay         sProdDelay;             // Latency compensation for the modulated signal
+                    dspu::Crossover     sCrossIn;               // Crossover for the input signal
+                    dspu::Crossover     sCrossSc;               // Crossover for the sidechain signal
+                    band_t              vBands[meta::ringmod_sc::BANDS_MAX];   // Bands
 
                     float               fPeak;                  // Current sidechain peak value
                     uint32_t            nHold;                  // Hold counter
+                    uint32_t            nLinkGroup;             // Link group, 0 if not linked
                     bool                vVisible[MG_TOTAL];     // Meter visibility
+                    bool                vMetered[MG_TOTAL];     // Meter graph is being processed
                     float               vValues[MG_TOTAL];      // Meter values
+                    float               vDot[MG_TOTAL];         // Values of the current meter graph dot
                     float              *vInData;                // Input signal data
                     float              *vBuffer;                // Temporary data
+                    float              *vOverHist;              // History of input and wet-scaled gain reduction to prime oversamplers
+                    float              *vEnvOut;                // Shared memory envelope send buffer
+                    float               fOverFade;              // Amount of oversampled signal at the end of last chunk
+                    uint32_t            nOverHold;              // Number of samples to keep oversampling active
 
                     // Ports
                     plug::IPort        *pIn;                    // Input port
                     plug::IPort        *pOut;                   // Output port
                     plug::IPort        *pScIn;                  // Sidechain input port
-                    plug::IPort        *pShmIn;                 // Shared memory link input port
+                    plug::IPort        *vShmIn[meta::ringmod_sc::LINKS_MAX];    // Shared memory link input ports
+                    plug::IPort        *pEnvOut;                // Shared memory envelope send port
+                    plug::IPort        *pLinkGroup;             // Link group
                     plug::IPort        *vVisibility[MG_TOTAL];  // Meters visibility
                     plug::IPort        *vMeters[MG_TOTAL];      // Meters
                 } channel_t;
 
             protected:
                 uint32_t            nChannels;              // Number of channels
+                bool                bShmLink;               // Shared memory link is present
+                uint32_t            nBufSize;               // Size of temporary buffers in samples
                 channel_t          *vChannels;              // Processing channels
+                io_buffers_t       *vIOBuffers;             // I/O buffers for each channel
+                float             **vSc;                    // Sidechain buffers for each channel
+                float             **vBandSc;                // Sidechain buffers of the processed band for each channel
+                uint32_t           *vLinked;                // List of channels of the processed link group
                 float              *vEmptyBuffer;           // Empty buffer for audio processing
                 float              *vTime;                  // Mesh time points
                 float              *vBuffer;                // Temporary buffer for audio processing
+                float              *vBandSum;               // Sum of modulated bands
+                float              *vBandEnv;               // Maximum envelope of bands
                 float              *vIDisplay;              // Inline display buffer
                 premix_t            sPremix;                // Sidechain pre-mix
                 uint32_t            nType;                  // Sidechain type
                 uint32_t            nSource;                // Sidechain source
                 uint32_t            nLookahead;             // Lookahead
                 uint32_t            nDuck;                  // Ducking
+                uint32_t            nLkMode;                // Lookahead mode
+                uint32_t            nLinkMode;              // Combination of shared memory links
+                uint32_t            nOverMode;              // Oversampling mode
+                uint32_t            nOverTimes;             // Oversampling factor
+                uint32_t            nOverLatency;           // Latency introduced by oversampling
+                uint32_t            nWndTime;               // Current time of the running maximum
+                uint32_t            nDetMode;               // Detector mode
+                uint32_t            nDetWindow;             // Detector window in samples
+                uint32_t            nDetCapacity;           // Maximum detector window in samples
+                uint32_t            nBands;                 // Number of bands
+                float               vSplit[meta::ringmod_sc::BANDS_MAX - 1]; // Split frequencies applied to crossovers
                 uint32_t            nHold;                  // Hold signal
                 float               fTauRelease;            // Release time constant
                 float               fStereoLink;            // Stereo linking
-                float               fInGain;                // Input gain
                 float               fOutGain;               // Output gain
-                float               fScGain;                // Sidechain gain
-                float               fAmount;                // The amount of data to subtract
-                float               fDry;                   // Dry amount of signal
-                float               fWet;                   // Wet amount of signal
+                ramp_t              sInGain;                // Input gain
+                ramp_t              sScGain;                // Sidechain gain
+                ramp_t              sScOutGain;             // Sidechain output gain
+                ramp_t              sAmount;                // The amount of data to subtract
+                ramp_t              sDry;                   // Dry amount of signal
+                ramp_t              sWet;                   // Wet amount of signal
+                bool                bRampReset;             // Jump to the target values instead of ramping
                 bool                bOutIn;                 // Output inpug signal
                 bool                bOutSc;                 // Output sidechain value
                 bool                bActive;                // Sidechain processing is active
+                bool                bScFilter;              // Sidechain filtering is enabled
+                bool                bCrossSync;             // Crossovers should be reconfigured
                 bool                bInvert;                // Invert sidechain processing
+                bool                bIdle;                  // The processing chain is idle
+                uint32_t            nIdleSamples;           // Number of samples processed in silence
                 bool                bPause;                 // Pause output graph
                 bool                bClear;                 // Clear output graph
                 bool                bUISync;                // Synchronize mesh with UI
+                bool                bUIActive;              // UI is currently active
+                uint32_t            nIDisplayAge;           // Number of UI refresh periods since the last inline display draw
+                bool                bMetering;              // Meter graph dots should be computed
+                uint32_t            nDotPeriod;             // Number of samples per meter graph dot
+                uint32_t            nDotPhase;              // Number of samples accumulated in the current dot
+                uint32_t            nRefreshPeriod;         // Number of samples between UI updates
+                uint32_t            nRefreshCounter;        // Number of samples since the last UI update
+                bool                bProfile;               // Measure processing time
+                profile_t           sProfile;               // Processing time measurements
+                SettingsTask        sSettingsTask;          // Computes the settings snapshot in background
+                settings_request_t  sRequest;               // Latest settings request, owned by the processing thread
+                settings_request_t  sTaskRequest;           // Settings request being computed by the task
+                settings_t          vSettings[2];           // Settings snapshots
+                settings_t         *pSettings;              // Snapshot applied by the processing thread
+                settings_t         *pPending;               // Snapshot computed by the task
+                bool                bSettingsSync;          // Settings snapshot should be recomputed
 
                 core::IDBuffer     *pIDisplay;              // Inline display buffer
 
@@ -173,10 +396,21 @@ namespace lsp
                 plug::IPort        *pType;                  // Sidechain type
                 plug::IPort        *pSource;                // Sidechain source
                 plug::IPort        *pStereoLink;            // Stereo linking
+                plug::IPort        *pHpfMode;               // Sidechain high-pass filter mode
+                plug::IPort        *pHpfFreq;               // Sidechain high-pass filter frequency
+                plug::IPort        *pLpfMode;               // Sidechain low-pass filter mode
+                plug::IPort        *pLpfFreq;               // Sidechain low-pass filter frequency
+                plug::IPort        *pDetMode;               // Detector mode
+                plug::IPort        *pDetWindow;             // Detector window
+                plug::IPort        *pBands;                 // Number of bands
+                plug::IPort        *pSplit[meta::ringmod_sc::BANDS_MAX - 1];   // Split frequencies
                 plug::IPort        *pHold;                  // Hold time
                 plug::IPort        *pRelease;               // Release time
                 plug::IPort        *pLookahead;             // Lookahead time
                 plug::IPort        *pDuck;                  // Duck time
+                plug::IPort        *pLkMode;                // Lookahead mode
+                plug::IPort        *pLinkMode;              // Combination of shared memory links
+                plug::IPort        *pOverMode;              // Oversampling mode
                 plug::IPort        *pAmount;                // Amount
                 plug::IPort        *pDry;                   // Dry gain
                 plug::IPort        *pWet;                   // Wet gain
@@ -184,23 +418,70 @@ namespace lsp
                 plug::IPort        *pGraphMesh;             // Meter graph mesh
                 plug::IPort        *pPause;                 // Pause graph processing
                 plug::IPort        *pClear;                 // Clear
+                plug::IPort        *pProfile;               // Measure processing time
+                plug::IPort        *pDspLoad;               // DSP load meter
 
                 uint8_t            *pData;                  // Allocated data
+                uint8_t            *pWndData;               // Allocated data for running maximum
+                uint8_t            *pDetData;               // Allocated data for detectors
+                float              *vOverBuf[2];            // Buffers for oversampled signals
+                float              *vOverProd;              // Modulated signal at the original sample rate
 
             protected:
                 void                do_destroy();
+                static void         init_ramp(ramp_t *r, float value);
+                static void         dump_ramp(dspu::IStateDumper *v, const char *name, const ramp_t *r);
+                static uint64_t     profile_time();
+                static uint64_t     profile_elapsed(uint64_t start, uint64_t end);
+                static void         split_input(void *object, void *subject, size_t band, const float *data, size_t first, size_t count);
+                static void         split_sidechain(void *object, void *subject, size_t band, const float *data, size_t first, size_t count);
+                static void         compute_settings(settings_t *dst, const settings_request_t *req);
+                static void         dump_request(dspu::IStateDumper *v, const char *name, const settings_request_t *r);
+                static void         dump_settings(dspu::IStateDumper *v, const char *name, const settings_t *s);
+
+            protected:
                 void                update_premix();
+                void                update_oversampling();
+                void                sync_settings();
+                void                apply_settings(const settings_t *s);
+                void                start_ramps(size_t samples);
+                void                advance_ramps(size_t samples);
+                void                complete_ramps();
                 void                premix_channels(io_buffers_t *io, size_t samples);
+                bool                process_sidechain_frontend(float **sc, io_buffers_t *io_buf, size_t samples);
                 void                process_sidechain_type(float **sc, io_buffers_t *io_buf, size_t samples);
+                void                process_sidechain_subscribe(float **sc, io_buffers_t *io_buf, size_t samples);
+                void                publish_envelope(size_t samples);
+                void                reset_detectors();
+                void                process_detector(detector_t *d, float *dst, const float *src, size_t samples);
+                void                process_sidechain_filters(float **sc, size_t samples);
                 void                process_sidechain_envelope(float **sc, size_t samples);
                 void                process_sidechain_delays(float **sc, size_t samples);
-                void                process_sidechain_stereo_link(float **sc, size_t samples);
+                void                process_window_max(window_max_t *w, float *buf, size_t samples);
+                void                process_sidechain_link(float **sc, size_t samples);
+                void                process_sidechain_bands(float **sc, size_t samples);
                 void                apply_sidechain_signal(io_buffers_t *io_buf, size_t samples);
+                void                apply_sidechain_bands(io_buffers_t *io_buf, size_t samples);
+                void                prime_oversampling(channel_t *c);
+                void                process_oversampling(channel_t *c, float wet, float dwet, bool modulated, size_t samples);
+                void                process_chain(size_t samples);
+                bool                inputs_silent(size_t samples) const;
+                bool                envelopes_silent() const;
+                void                reset_bands();
+                void                update_idle_state(bool quiet, size_t samples);
+                void                process_idle(size_t samples);
+                void                update_metering();
+                void                reset_profile();
+                uint64_t            profile_stage(size_t stage, uint64_t start);
+                void                update_profile(uint64_t start, size_t samples, bool refresh);
+                void                reset_meter_dot(channel_t *c);
+                void                update_meter_values(channel_t *c, const float *values);
+                size_t              update_meter_dot(channel_t *c, const float *values, size_t phase, size_t samples);
                 void                output_meters();
-                void                output_meshes();
+                void                output_meshes(bool refresh);
 
             public:
-                explicit ringmod_sc(const meta::plugin_t *meta);
+                explicit ringmod_sc(const meta::plugin_t *meta, size_t channels, bool shm_link);
                 ringmod_sc (const ringmod_sc &) = delete;
                 ringmod_sc (ringmod_sc &&) = delete;
                 virtual ~ringmod_sc() override;
@@ -215,6 +496,7 @@ namespace lsp
                 virtual void        update_sample_rate(long sr) override;
                 virtual void        update_settings() override;
                 virtual void        ui_activated() override;
+                virtual void        ui_deactivated() override;
                 virtual void        process(size_t samples) override;
                 virtual bool        inline_display(plug::ICanvas *cv, size_t width, size_t height) override;
                 virtual void        dump(dspu::IStateDumper *v) const override;
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-ringmod-sc
+ * Created on: 15 окт 2026 г.
+ *
+ * lsp-plugins-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_PLUGINS_RINGMOD_SC_BATCH_H_
+#define PRIVATE_PLUGINS_RINGMOD_SC_BATCH_H_
+
+#include <lsp-plug.in/common/types.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * Batch processor for many mono sidechain ducking strips. Runs the envelope
+         * follower and the gain stage for several strips at once, one strip per SIMD
+         * lane. The result matches the ringmod_sc plugin with external sidechain,
+         * no lookahead, no pre-mix and no oversampling within the rounding error:
+         * the gain stage is evaluated in a different order, so the output is not
+         * bit-exact.
+         */
+        class ringmod_sc_batch
+        {
+            public:
+                typedef struct strip_t
+                {
+                    float               fInGain;                // Input gain
+                    float               fScGain;                // Sidechain gain
+                    float               fTauRelease;            // Release time constant
+                    uint32_t            nHold;                  // Hold time in samples
+                    float               fAmount;                // Sidechain amount
+                    float               fDry;                   // Dry signal gain
+                    float               fWet;                   // Wet signal gain
+                    bool                bInvert;                // Invert sidechain processing
+                } strip_t;
+
+            protected:
+                size_t              nStrips;                // Number of strips
+                size_t              nCapacity;              // Number of strips aligned to the number of lanes
+
+                // Structure of arrays, one element per strip
+                float              *vPeak;                  // Current sidechain peak value
+                uint32_t           *vHold;                  // Hold counter
+                uint32_t           *vHoldMax;               // Hold time in samples
+                float              *vTauRelease;            // Release time constant
+                float              *vInGain;                // Input gain
+                float              *vScGain;                // Sidechain gain
+                float              *vAmount;                // Sidechain amount
+                float              *vDry;                   // Dry signal gain
+                float              *vWet;                   // Wet signal gain
+                uint32_t           *vInvert;                // Invert sidechain processing
+
+                // Lane-interleaved tiles
+                float              *vTileIn;                // Input signal
+                float              *vTileSc;                // Sidechain signal
+                float              *vTileOut;               // Output signal
+
+                uint8_t            *pData;                  // Allocated data
+
+            protected:
+                void                process_tile(size_t first, size_t samples);
+
+            public:
+                explicit ringmod_sc_batch();
+                ringmod_sc_batch(const ringmod_sc_batch &) = delete;
+                ringmod_sc_batch(ringmod_sc_batch &&) = delete;
+                ~ringmod_sc_batch();
+
+                ringmod_sc_batch & operator = (const ringmod_sc_batch &) = delete;
+                ringmod_sc_batch & operator = (ringmod_sc_batch &&) = delete;
+
+                /**
+                 * Initialize the batch processor
+                 * @param strips number of strips
+                 * @return true on success
+                 */
+                bool                init(size_t strips);
+
+                /**
+                 * Destroy the batch processor
+                 */
+                void                destroy();
+
+            public:
+                /**
+                 * Get number of strips
+                 * @return number of strips
+                 */
+                inline size_t       strips() const          { return nStrips; }
+
+                /**
+                 * Update settings of the strip
+                 * @param index index of the strip
+                 * @param settings settings of the strip
+                 */
+                void                set_strip(size_t index, const strip_t *settings);
+
+                /**
+                 * Reset the state of envelope followers
+                 */
+                void                reset();
+
+                /**
+                 * Process all strips
+                 * @param out output buffers, one per strip
+                 * @param in input buffers, one per strip
+                 * @param sc sidechain buffers, one per strip
+                 * @param samples number of samples to process
+                 */
+                void                process(float * const *out, const float * const *in, const float * const *sc, size_t samples);
+        };
+
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_PLUGINS_RINGMOD_SC_BATCH_H_ */
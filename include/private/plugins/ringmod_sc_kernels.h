@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-ringmod-sc
+ * Created on: 15 окт 2026 г.
+ *
+ * lsp-plugins-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_PLUGINS_RINGMOD_SC_KERNELS_H_
+#define PRIVATE_PLUGINS_RINGMOD_SC_KERNELS_H_
+
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp-units/units.h>
+#include <lsp-plug.in/stdlib/math.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * Per-sample computation steps shared by the plugin and the batch processor.
+         * Both of them should use these functions to produce identical results.
+         */
+        namespace ringmod_sc_kernels
+        {
+            /**
+             * Branch-free single step of the envelope follower
+             *
+             * @param s rectified sidechain sample
+             * @param p current peak value
+             * @param h current hold counter
+             * @param hold_max hold time in samples
+             * @param tau release time constant
+             * @return envelope value
+             */
+            inline float envelope_step(float s, float & p, uint32_t & h, uint32_t hold_max, float tau)
+            {
+                const float r       = p + (s - p) * tau;
+                const bool below    = p > s;
+                const bool held     = h > 0;
+
+                s                   = (below) ? ((held) ? p : r) : s;
+                h                   = (below) ? ((held) ? h - 1 : 0) : hold_max;
+                p                   = s;
+
+                return s;
+            }
+
+            /**
+             * Reference envelope follower: rectify the signal and apply hold/release
+             * to the peak value, one sample at a time.
+             *
+             * @param dst destination buffer to store the envelope
+             * @param src source sidechain signal
+             * @param gain sidechain gain at the first sample
+             * @param dgain sidechain gain increment per sample
+             * @param tau release time constant
+             * @param hold_max hold time in samples
+             * @param peak current peak value
+             * @param hold current hold counter
+             * @param count number of samples to process
+             */
+            inline void envelope_x1(
+                float *dst, const float *src,
+                float gain, float dgain, float tau, uint32_t hold_max,
+                float *peak, uint32_t *hold,
+                size_t count)
+            {
+                uint32_t h          = *hold;
+                float p             = *peak;
+
+                for (size_t j=0; j<count; ++j)
+                {
+                    float s             = fabsf(src[j] * (gain + dgain * j)); // Rectify input
+                    if (p > s)
+                    {
+                        // Current rectified sample is below the peak value
+                        if (h > 0)
+                        {
+                            s                   = p;                // Hold peak value
+                            --h;
+                        }
+                        else
+                        {
+                            s                   = p + (s - p) * tau;
+                            p                   = s;
+                        }
+                    }
+                    else
+                    {
+                        p                   = s;
+                        h                   = hold_max;             // Reset hold counter
+                    }
+                    dst[j]              = s;
+                }
+
+                *hold               = h;
+                *peak               = p;
+            }
+
+            /**
+             * Two-lane envelope follower: processes a pair of channels at once,
+             * each lane keeps its own peak and hold state. The result is
+             * bit-identical to the envelope_x1() applied to each channel.
+             *
+             * @param dst destination buffers to store the envelope
+             * @param src source sidechain signals
+             * @param gain sidechain gain at the first sample
+             * @param dgain sidechain gain increment per sample
+             * @param tau release time constant
+             * @param hold_max hold time in samples
+             * @param peak current peak values for each lane
+             * @param hold current hold counters for each lane
+             * @param count number of samples to process
+             */
+            inline void envelope_x2(
+                float * const *dst, const float * const *src,
+                float gain, float dgain, float tau, uint32_t hold_max,
+                float *peak, uint32_t *hold,
+                size_t count)
+            {
+                float * const d0    = dst[0];
+                float * const d1    = dst[1];
+                const float *s0     = src[0];
+                const float *s1     = src[1];
+                float p0            = peak[0];
+                float p1            = peak[1];
+                uint32_t h0         = hold[0];
+                uint32_t h1         = hold[1];
+
+                for (size_t j=0; j<count; ++j)
+                {
+                    const float k       = gain + dgain * j;
+                    d0[j]               = envelope_step(fabsf(s0[j] * k), p0, h0, hold_max, tau);
+                    d1[j]               = envelope_step(fabsf(s1[j] * k), p1, h1, hold_max, tau);
+                }
+
+                peak[0]             = p0;
+                peak[1]             = p1;
+                hold[0]             = h0;
+                hold[1]             = h1;
+            }
+
+            /**
+             * Compute the release time constant of the envelope follower
+             *
+             * @param sr sample rate
+             * @param release release time in milliseconds
+             * @return release time constant
+             */
+            inline float release_tau(float sr, float release)
+            {
+                return 1.0f - expf(logf(1.0f - M_SQRT1_2) / (dspu::millis_to_samples(sr, release)));
+            }
+
+            /**
+             * Compute gain reduction from the envelope value
+             *
+             * @param e envelope value
+             * @param amount sidechain amount
+             * @return gain reduction
+             */
+            template <bool invert>
+            inline float gain_reduction(float e, float amount)
+            {
+                return (invert) ? e * amount : lsp_max(0.0f, GAIN_AMP_0_DB - e * amount);
+            }
+
+            /**
+             * Mix the dry signal and the signal with applied gain reduction
+             *
+             * @param g gain reduction
+             * @param x input sample
+             * @param dry dry signal gain
+             * @param wet wet signal gain
+             * @return output sample
+             */
+            inline float mix(float g, float x, float dry, float wet)
+            {
+                return (g * x) * wet + x * dry;
+            }
+
+        } /* namespace ringmod_sc_kernels */
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_PLUGINS_RINGMOD_SC_KERNELS_H_ */
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-ringmod-sc
+ * Created on: 16 окт 2026 г.
+ *
+ * lsp-plugins-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_PLUGINS_RINGMOD_SC_RENDER_H_
+#define PRIVATE_PLUGINS_RINGMOD_SC_RENDER_H_
+
+#include <lsp-plug.in/common/status.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/lltl/darray.h>
+#include <lsp-plug.in/mm/InAudioFileStream.h>
+#include <lsp-plug.in/mm/OutAudioFileStream.h>
+#include <lsp-plug.in/plug-fw/core/AudioBuffer.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * Offline renderer: streams the input, sidechain and shared memory link audio
+         * files through the ringmod_sc plugin in large blocks and writes the output
+         * file. All buffers are allocated once by init() and reused for each job, so
+         * the memory used by the renderer does not depend on the length of the files.
+         */
+        class ringmod_sc_render
+        {
+            public:
+                static constexpr size_t CHANNELS_MAX    = 8;
+                static constexpr size_t BLOCK_SIZE_MIN  = 0x100;
+                static constexpr size_t BLOCK_SIZE_MAX  = 0x10000;
+                static constexpr size_t BLOCK_SIZE_DFL  = 0x2000;
+
+                typedef struct param_t
+                {
+                    char               *sId;                    // Port identifier
+                    float               fValue;                 // Value stored in the preset
+                    size_t              nFlags;                 // Serialization flags of the value
+                } param_t;
+
+                typedef lltl::darray<param_t> preset_t;
+
+                typedef struct job_t
+                {
+                    const char         *sIn;                    // Input file
+                    const char         *sSc;                    // Sidechain file, optional
+                    const char         *sLink;                  // Shared memory link file, optional
+                    const char         *sOut;                   // Output file
+                } job_t;
+
+            protected:
+                typedef struct source_t
+                {
+                    mm::InAudioFileStream   sStream;            // Audio file stream
+                    size_t                  nChannels;          // Number of channels in the file
+                    bool                    bEof;               // End of file reached
+                } source_t;
+
+            protected:
+                size_t              nBlockSize;             // Number of samples processed at once
+                float              *vFrame;                 // Interleaved audio data of the files
+                float              *vIn[CHANNELS_MAX];      // Input buffers
+                float              *vSc[CHANNELS_MAX];      // Sidechain buffers
+                float              *vOut[CHANNELS_MAX];     // Output buffers
+                core::AudioBuffer   vLink[CHANNELS_MAX];    // Shared memory link buffers
+                uint8_t            *pData;                  // Allocated data
+
+            protected:
+                static status_t     open_source(source_t *src, const char *path, size_t channels, size_t srate);
+                ssize_t             read_source(source_t *src, float * const *dst, size_t channels);
+                status_t            write_output(mm::OutAudioFileStream *os, size_t channels, size_t first, size_t last);
+
+            public:
+                explicit ringmod_sc_render();
+                ringmod_sc_render(const ringmod_sc_render &) = delete;
+                ringmod_sc_render(ringmod_sc_render &&) = delete;
+                ~ringmod_sc_render();
+
+                ringmod_sc_render & operator = (const ringmod_sc_render &) = delete;
+                ringmod_sc_render & operator = (ringmod_sc_render &&) = delete;
+
+                /**
+                 * Initialize the renderer
+                 * @param block_size number of samples processed at once
+                 * @return true on success
+                 */
+                bool                init(size_t block_size);
+
+                /**
+                 * Destroy the renderer
+                 */
+                void                destroy();
+
+            public:
+                /**
+                 * Load the plugin preset
+                 * @param preset list to store the parameters
+                 * @param path path to the configuration file
+                 * @return status of operation
+                 */
+                static status_t     load_preset(preset_t *preset, const char *path);
+
+                /**
+                 * Free the parameters of the preset
+                 * @param preset preset to free
+                 */
+                static void         free_preset(preset_t *preset);
+
+                /**
+                 * Render the job. The plugin variant is selected by the number of channels
+                 * of the input file. The output is compensated for the latency of the plugin
+                 * and has the same length as the input.
+                 *
+                 * @param job job to render
+                 * @param preset preset to apply to the plugin, may be NULL
+                 * @return status of operation
+                 */
+                status_t            render(const job_t *job, const preset_t *preset);
+        };
+
+    } /* namespace plugins */
+} /* namespace lsp */
+
+#endif /* PRIVATE_PLUGINS_RINGMOD_SC_RENDER_H_ */
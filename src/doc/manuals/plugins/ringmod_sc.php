@@ -1,6 +1,7 @@
 <?php
 	plugin_header();
-	$m      =   ($PAGE == 'ringmod_sc_mono') ? 'm' : 's';
+	$m      =   ($PAGE == 'ringmod_sc_mono') ? 'm' : (
+	            ($PAGE == 'ringmod_sc_stereo') ? 's' : 'x');
 ?>
 
 <p>This plugins performs ring-modulated sidechaing of the audio signal.</p>
@@ -29,7 +30,14 @@ effect, additional smoothing, prediction and reactivity controls were added.</p>
 	<ul>
 		<li><b>Internal</b> - the input signal is taken as a sidechain after pre-mixing stage.</li>
 		<li><b>External</b> - the sidechain input signal is taken as a sidechain after pre-mixing stage.</li>
+		<?php if ($m != 'x') { ?>
 		<li><b>Link</b> - the shared memory link is used as a sidechain input signal after pre-mixing-stage.</li>
+		<li><b>Envelope</b> - the shared memory link contains the envelope published by another instance of the plugin. The envelope
+		is taken before the pre-mixing stage. The detector, filters, lookahead and stereo link are not computed, only the sidechain gain
+		is applied. The published envelope already contains the lookahead of the publishing instance, while the own lookahead only delays
+		the input signal, so the lookahead of both instances should be set to the same value to keep the envelope aligned with the input
+		signal. The sidechain output still passes the external sidechain signal.</li>
+		<?php } ?>
 	</ul>
 	<?php if ($m == 's') { ?>
 	<li><b>Source</b> - The sidechain source type for both left and right channels:</li>
@@ -46,9 +54,22 @@ effect, additional smoothing, prediction and reactivity controls were added.</p>
 		<li><b>Max</b> both the left and right channels are processed using the maximum signal between left and right channels of sidechain.</li>
 	</ul>
 	<?php } ?>
+	<li><b>DSP load</b> - enables measurement of the processing time and shows the DSP load in percents: the ratio of the time spent
+	on processing to the duration of the processed audio.</li>
 	<li><b>Pre-mix</b> - shows pre-mix control overlay.</li>
 	<li><b>Mix</b> - shows the Dry/Wet control overlay.</li>
-	<li><b>Link</b> - the name of the shared memory link to pass sidechain signal.</li>
+	<?php if ($m != 'x') { ?>
+	<li><b>Link</b> - the names of up to three shared memory links to pass sidechain signal. Signals of all connected links
+	are combined into one link signal before the pre-mixing stage.</li>
+	<li><b>Links mix</b> - the way the signals of several connected shared memory links are combined:</li>
+	<ul>
+		<li><b>Sum</b> - the signals of links are summed.</li>
+		<li><b>Max</b> - the sample with the greatest magnitude is taken from all links keeping its sign, so the result can be safely
+		routed to the input and sidechain by the pre-mix stage.</li>
+	</ul>
+	<li><b>Envelope send</b> - the name of the shared memory link to publish the computed sidechain envelope. Other instances of the plugin
+	may receive it with the <b>Envelope</b> sidechain type. In multiband mode the maximum of envelopes of all bands is published.</li>
+	<?php } ?>
 	<li><b>SC</b> - enables drawing of sidechain input graph and corresponding level meter.</li>
 	<li><b>Gain</b> - enables drawing of gain amplification line and corresponding amplification meter.</li>
 	<li><b>In</b> - enables drawing of input signal graph and corresponding level meter.</li>
@@ -59,14 +80,60 @@ effect, additional smoothing, prediction and reactivity controls were added.</p>
 <ul>
 	<li><b>Lookahead</b> - allows to add some small delay to the signal and force sidechain to reduce the input signal earlier than actual peak happens.</li>
 	<li><b>Ducking</b> - allows to add some small post-delay to the sidechain signal to force slower shutdown of the sidechain signal.</li>
+	<li><b>Lookahead mode</b> - the way how the lookahead and ducking are applied to the sidechain envelope:</li>
+	<ul>
+		<li><b>Taps</b> - the envelope is computed as a maximum of the current, the lookahead-delayed and the ducking-delayed envelope values.</li>
+		<li><b>Window</b> - the envelope is computed as a maximum over the whole window covered by the lookahead and ducking time, so short
+		transients between taps are not missed.</li>
+	</ul>
+	<li><b>Oversampling</b> - the oversampling factor for the modulation of the input signal by the gain reduction. Fast gain changes
+	produce high-frequency sidebands which are aliased at the original sample rate, the oversampling reduces this effect. The
+	oversampling is enabled only while the gain reduction changes and introduces additional latency.</li>
+	<li><b>Bands</b> - the number of frequency bands. With more than one band, the input and the sidechain signals are split into bands
+	by the crossover, the detector, envelope, hold, release, lookahead, ducking and amount are applied to each band separately and the
+	processed bands are summed. The oversampling is not applied in this mode.</li>
+	<li><b>Detector</b> - the way how the level of the sidechain signal is detected:</li>
+	<ul>
+		<li><b>Peak</b> - the absolute value of the sidechain signal is used.</li>
+		<li><b>RMS</b> - the root mean square of the sidechain signal over the detector window is used.</li>
+		<li><b>Mean</b> - the mean absolute value of the sidechain signal over the detector window is used.</li>
+	</ul>
+	<li><b>Reactivity</b> - the size of the detector window for the <b>RMS</b> and <b>Mean</b> detectors. Longer windows make the
+	gain reduction smoother for dense sidechain signals.</li>
 	<li><b>Hold</b> - the time period the sidechain envelope holds it's maximum value before starting the release.</li>
 	<li><b>Release</b> - the release time of the sidechain.</li>
 	<li><b>Amount</b> - the additional pre-amplification of the sidechain signal before the limiting stage.</li>
 	<?php if ($m == 's') { ?>
 	<li><b>Stereo link</b> - the knob that allows to set how the gain reduction of the left channel affects the gain reduction of the right channel and vice verse.</li>
+	<?php } else if ($m == 'x') { ?>
+	<li><b>Stereo link</b> - the knob that allows to set how the gain reduction of each channel affects the gain reduction of other channels in the same link group.</li>
 	<?php } ?>
 </ul>
 
+<p><b>Sidechain filter</b> section:</p>
+<ul>
+	<li><b>HPF</b> - the cut-off frequency and the slope of the high-pass filter applied to the sidechain signal before the detector.</li>
+	<li><b>LPF</b> - the cut-off frequency and the slope of the low-pass filter applied to the sidechain signal before the detector.</li>
+</ul>
+<p>Enabling both filters makes a band-pass filter which allows to key the processing on the specific frequency range of the sidechain
+signal, for example on the kick drum only. The filters do not affect the sidechain signal passed to the output.</p>
+
+<p><b>Split frequencies</b> section:</p>
+<ul>
+	<li><b>Split 1</b>, <b>Split 2</b>, <b>Split 3</b> - the crossover frequencies between bands, only the first <b>Bands</b> - 1 split
+	frequencies are used.</li>
+</ul>
+
+<?php if ($m == 'x') { ?>
+<p><b>Link groups</b> section:</p>
+<ul>
+	<li><b>None</b> - the channel is not linked to other channels.</li>
+	<li><b>A</b>, <b>B</b>, <b>C</b>, <b>D</b> - the channel belongs to the specified link group. The envelope of each channel in the group
+	is raised to the maximum envelope of the group proportionally to the <b>Stereo link</b> setting. By default, front channels are placed
+	into the group <b>A</b>, side channels into the group <b>B</b>, back channels into the group <b>C</b> and the LFE channel is not linked.</li>
+</ul>
+<?php } ?>
+
 <p><b>Signal</b> section:</p>
 <ul>
 	<li><b>Input</b> button - allows to pass the processed input signal tho the output of plugin.</li>
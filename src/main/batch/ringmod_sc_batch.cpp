@@ -0,0 +1,259 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-ringmod-sc
+ * Created on: 15 окт 2026 г.
+ *
+ * lsp-plugins-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/debug.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/units.h>
+
+#include <private/plugins/ringmod_sc_batch.h>
+#include <private/plugins/ringmod_sc_kernels.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        // Number of strips processed at once, should cover the widest SIMD register
+        static constexpr size_t BATCH_LANES     = 8;
+        // Number of samples in the lane-interleaved tile
+        static constexpr size_t BATCH_TILE      = 0x40;
+
+        ringmod_sc_batch::ringmod_sc_batch()
+        {
+            nStrips         = 0;
+            nCapacity       = 0;
+
+            vPeak           = NULL;
+            vHold           = NULL;
+            vHoldMax        = NULL;
+            vTauRelease     = NULL;
+            vInGain         = NULL;
+            vScGain         = NULL;
+            vAmount         = NULL;
+            vDry            = NULL;
+            vWet            = NULL;
+            vInvert         = NULL;
+
+            vTileIn         = NULL;
+            vTileSc         = NULL;
+            vTileOut        = NULL;
+
+            pData           = NULL;
+        }
+
+        ringmod_sc_batch::~ringmod_sc_batch()
+        {
+            destroy();
+        }
+
+        bool ringmod_sc_batch::init(size_t strips)
+        {
+            destroy();
+
+            const size_t capacity   = align_size(strips, BATCH_LANES);
+            const size_t szof_f32   = align_size(capacity * sizeof(float), OPTIMAL_ALIGN);
+            const size_t szof_u32   = align_size(capacity * sizeof(uint32_t), OPTIMAL_ALIGN);
+            const size_t szof_tile  = BATCH_TILE * BATCH_LANES * sizeof(float);
+            const size_t alloc      =
+                szof_f32 * 7 +      // vPeak, vTauRelease, vInGain, vScGain, vAmount, vDry, vWet
+                szof_u32 * 3 +      // vHold, vHoldMax, vInvert
+                szof_tile * 3;      // vTileIn, vTileSc, vTileOut
+
+            uint8_t *ptr            = alloc_aligned<uint8_t>(pData, alloc, OPTIMAL_ALIGN);
+            if (ptr == NULL)
+                return false;
+
+            vPeak                   = advance_ptr_bytes<float>(ptr, szof_f32);
+            vTauRelease             = advance_ptr_bytes<float>(ptr, szof_f32);
+            vInGain                 = advance_ptr_bytes<float>(ptr, szof_f32);
+            vScGain                 = advance_ptr_bytes<float>(ptr, szof_f32);
+            vAmount                 = advance_ptr_bytes<float>(ptr, szof_f32);
+            vDry                    = advance_ptr_bytes<float>(ptr, szof_f32);
+            vWet                    = advance_ptr_bytes<float>(ptr, szof_f32);
+            vHold                   = advance_ptr_bytes<uint32_t>(ptr, szof_u32);
+            vHoldMax                = advance_ptr_bytes<uint32_t>(ptr, szof_u32);
+            vInvert                 = advance_ptr_bytes<uint32_t>(ptr, szof_u32);
+            vTileIn                 = advance_ptr_bytes<float>(ptr, szof_tile);
+            vTileSc                 = advance_ptr_bytes<float>(ptr, szof_tile);
+            vTileOut                = advance_ptr_bytes<float>(ptr, szof_tile);
+
+            nStrips                 = strips;
+            nCapacity               = capacity;
+
+            // Initialize all strips including padding lanes
+            for (size_t i=0; i<capacity; ++i)
+            {
+                vPeak[i]                = 0.0f;
+                vHold[i]                = 0;
+                vHoldMax[i]             = 0;
+                vTauRelease[i]          = 1.0f;
+                vInGain[i]              = GAIN_AMP_0_DB;
+                vScGain[i]              = GAIN_AMP_0_DB;
+                vAmount[i]              = GAIN_AMP_0_DB;
+                vDry[i]                 = 0.0f;
+                vWet[i]                 = GAIN_AMP_0_DB;
+                vInvert[i]              = 0;
+            }
+
+            return true;
+        }
+
+        void ringmod_sc_batch::destroy()
+        {
+            free_aligned(pData);
+
+            nStrips         = 0;
+            nCapacity       = 0;
+
+            vPeak           = NULL;
+            vHold           = NULL;
+            vHoldMax        = NULL;
+            vTauRelease     = NULL;
+            vInGain         = NULL;
+            vScGain         = NULL;
+            vAmount         = NULL;
+            vDry            = NULL;
+            vWet            = NULL;
+            vInvert         = NULL;
+
+            vTileIn         = NULL;
+            vTileSc         = NULL;
+            vTileOut        = NULL;
+        }
+
+        void ringmod_sc_batch::set_strip(size_t index, const strip_t *settings)
+        {
+            if (index >= nStrips)
+                return;
+
+            vHoldMax[index]         = settings->nHold;
+            vTauRelease[index]      = settings->fTauRelease;
+            vInGain[index]          = settings->fInGain;
+            vScGain[index]          = settings->fScGain;
+            vAmount[index]          = settings->fAmount;
+            vDry[index]             = settings->fDry;
+            vWet[index]             = settings->fWet;
+            vInvert[index]          = (settings->bInvert) ? 1 : 0;
+        }
+
+        void ringmod_sc_batch::reset()
+        {
+            for (size_t i=0; i<nCapacity; ++i)
+            {
+                vPeak[i]                = 0.0f;
+                vHold[i]                = 0;
+            }
+        }
+
+        void ringmod_sc_batch::process_tile(size_t first, size_t samples)
+        {
+            float * const peak          = &vPeak[first];
+            uint32_t * const hold       = &vHold[first];
+            const uint32_t *hold_max    = &vHoldMax[first];
+            const float *tau            = &vTauRelease[first];
+            const float *in_gain        = &vInGain[first];
+            const float *sc_gain        = &vScGain[first];
+            const float *amount         = &vAmount[first];
+            const float *dry            = &vDry[first];
+            const float *wet            = &vWet[first];
+            const uint32_t *invert      = &vInvert[first];
+
+            float p[BATCH_LANES];
+            uint32_t h[BATCH_LANES];
+            for (size_t l=0; l<BATCH_LANES; ++l)
+            {
+                p[l]                    = peak[l];
+                h[l]                    = hold[l];
+            }
+
+            // Each iteration of the inner loop processes independent strips
+            // and is subject for vectorization
+            for (size_t j=0; j<samples; ++j)
+            {
+                const float *tin        = &vTileIn[j * BATCH_LANES];
+                const float *tsc        = &vTileSc[j * BATCH_LANES];
+                float *tout             = &vTileOut[j * BATCH_LANES];
+
+                for (size_t l=0; l<BATCH_LANES; ++l)
+                {
+                    const float x           = tin[l] * in_gain[l];
+                    const float s           = fabsf(tsc[l] * sc_gain[l]);
+                    const float e           = ringmod_sc_kernels::envelope_step(s, p[l], h[l], hold_max[l], tau[l]);
+                    const float g           = (invert[l]) ?
+                                                ringmod_sc_kernels::gain_reduction<true>(e, amount[l]) :
+                                                ringmod_sc_kernels::gain_reduction<false>(e, amount[l]);
+                    tout[l]                 = ringmod_sc_kernels::mix(g, x, dry[l], wet[l]);
+                }
+            }
+
+            for (size_t l=0; l<BATCH_LANES; ++l)
+            {
+                peak[l]                 = p[l];
+                hold[l]                 = h[l];
+            }
+        }
+
+        void ringmod_sc_batch::process(float * const *out, const float * const *in, const float * const *sc, size_t samples)
+        {
+            for (size_t first=0; first < nStrips; first += BATCH_LANES)
+            {
+                const size_t lanes      = lsp_min(nStrips - first, BATCH_LANES);
+
+                // Padding lanes process silence
+                if (lanes < BATCH_LANES)
+                {
+                    dsp::fill_zero(vTileIn, BATCH_TILE * BATCH_LANES);
+                    dsp::fill_zero(vTileSc, BATCH_TILE * BATCH_LANES);
+                }
+
+                for (size_t offset=0; offset < samples; )
+                {
+                    const size_t count      = lsp_min(samples - offset, BATCH_TILE);
+
+                    // Interleave input data of strips
+                    for (size_t l=0; l<lanes; ++l)
+                    {
+                        const float *src_in     = &in[first + l][offset];
+                        const float *src_sc     = &sc[first + l][offset];
+                        for (size_t j=0; j<count; ++j)
+                        {
+                            vTileIn[j * BATCH_LANES + l]    = src_in[j];
+                            vTileSc[j * BATCH_LANES + l]    = src_sc[j];
+                        }
+                    }
+
+                    process_tile(first, count);
+
+                    // De-interleave output data of strips
+                    for (size_t l=0; l<lanes; ++l)
+                    {
+                        float *dst              = &out[first + l][offset];
+                        for (size_t j=0; j<count; ++j)
+                            dst[j]                  = vTileOut[j * BATCH_LANES + l];
+                    }
+
+                    offset                 += count;
+                }
+            }
+        }
+
+    } /* namespace plugins */
+} /* namespace lsp */
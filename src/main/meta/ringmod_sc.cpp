@@ -47,6 +47,73 @@ namespace lsp
             { "Internal",       "sidechain.internal" },
             { "External",       "sidechain.external" },
             { "Link",           "sidechain.link" },
+            { "Envelope",       "sidechain.envelope" },
+            { NULL, NULL }
+        };
+
+        static const port_item_t ringmod_sc_surround_types[] =
+        {
+            { "Internal",       "sidechain.internal" },
+            { "External",       "sidechain.external" },
+            { NULL, NULL }
+        };
+
+        static const port_item_t ringmod_sc_link_modes[] =
+        {
+            { "Sum",            "ringmod_sc.link.sum"       },
+            { "Max",            "ringmod_sc.link.max"       },
+            { NULL, NULL }
+        };
+
+        static const port_item_t ringmod_sc_link_groups[] =
+        {
+            { "None",           "ringmod_sc.group.none"     },
+            { "A",              "ringmod_sc.group.a"        },
+            { "B",              "ringmod_sc.group.b"        },
+            { "C",              "ringmod_sc.group.c"        },
+            { "D",              "ringmod_sc.group.d"        },
+            { NULL, NULL }
+        };
+
+        static const port_item_t ringmod_sc_lookahead_modes[] =
+        {
+            { "Taps",           "ringmod_sc.lookahead.taps"     },
+            { "Window",         "ringmod_sc.lookahead.window"   },
+            { NULL, NULL }
+        };
+
+        static const port_item_t ringmod_sc_filter_slopes[] =
+        {
+            { "off",            "eq.slope.off"      },
+            { "12 dB/oct",      "eq.slope.12dbo"    },
+            { "24 dB/oct",      "eq.slope.24dbo"    },
+            { "36 dB/oct",      "eq.slope.36dbo"    },
+            { NULL, NULL }
+        };
+
+        static const port_item_t ringmod_sc_detect_modes[] =
+        {
+            { "Peak",           "ringmod_sc.detect.peak"    },
+            { "RMS",            "ringmod_sc.detect.rms"     },
+            { "Mean",           "ringmod_sc.detect.mean"    },
+            { NULL, NULL }
+        };
+
+        static const port_item_t ringmod_sc_oversampling_modes[] =
+        {
+            { "None",           "ringmod_sc.ovs.none"       },
+            { "2x",             "ringmod_sc.ovs.x2"         },
+            { "4x",             "ringmod_sc.ovs.x4"         },
+            { "8x",             "ringmod_sc.ovs.x8"         },
+            { NULL, NULL }
+        };
+
+        static const port_item_t ringmod_sc_band_counts[] =
+        {
+            { "1",              "ringmod_sc.bands.1"        },
+            { "2",              "ringmod_sc.bands.2"        },
+            { "3",              "ringmod_sc.bands.3"        },
+            { "4",              "ringmod_sc.bands.4"        },
             { NULL, NULL }
         };
 
@@ -77,9 +144,51 @@ namespace lsp
     #define RMOD_SHM_LINK_MONO \
         OPT_RETURN_MONO("link", "shml", "Side-chain shared memory link")
 
+    #define RMOD_SHM_LINK_EXT_MONO \
+        OPT_RETURN_MONO("link2", "shml2", "Side-chain shared memory link 2"), \
+        OPT_RETURN_MONO("link3", "shml3", "Side-chain shared memory link 3"), \
+        COMBO("lkcmb", "Shared memory links combination", "Links mix", 0, ringmod_sc_link_modes), \
+        OPT_SEND_MONO("envs", "shme", "Sidechain envelope shared memory send")
+
     #define RMOD_SHM_LINK_STEREO \
         OPT_RETURN_STEREO("link", "shml_", "Side-chain shared memory link")
 
+    #define RMOD_SHM_LINK_EXT_STEREO \
+        OPT_RETURN_STEREO("link2", "shml2_", "Side-chain shared memory link 2"), \
+        OPT_RETURN_STEREO("link3", "shml3_", "Side-chain shared memory link 3"), \
+        COMBO("lkcmb", "Shared memory links combination", "Links mix", 0, ringmod_sc_link_modes), \
+        OPT_SEND_STEREO("envs", "shme_", "Sidechain envelope shared memory send")
+
+    #define RMOD_SC_FILTERS \
+        COMBO("shpm", "High-pass filter mode", "HPF mode", 0, ringmod_sc_filter_slopes), \
+        LOG_CONTROL("shpf", "High-pass filter frequency", "HPF freq", U_HZ, ringmod_sc::HPF), \
+        COMBO("slpm", "Low-pass filter mode", "LPF mode", 0, ringmod_sc_filter_slopes), \
+        LOG_CONTROL("slpf", "Low-pass filter frequency", "LPF freq", U_HZ, ringmod_sc::LPF)
+
+    #define RMOD_BANDS \
+        COMBO("bands", "Number of bands", "Bands", 0, ringmod_sc_band_counts), \
+        LOG_CONTROL("sf1", "Split frequency 1", "Split 1", U_HZ, ringmod_sc::SPLIT1), \
+        LOG_CONTROL("sf2", "Split frequency 2", "Split 2", U_HZ, ringmod_sc::SPLIT2), \
+        LOG_CONTROL("sf3", "Split frequency 3", "Split 3", U_HZ, ringmod_sc::SPLIT3)
+
+    #define RMOD_PROFILE \
+        SWITCH("prof", "Measure DSP load", "Measure load", 0.0f), \
+        METER("dspload", "DSP load", U_PERCENT, ringmod_sc::DSP_LOAD)
+
+    // Controls added after the first release, they go after all other ports
+    // to keep indices of existing ports
+    #define RMOD_EXT_CONTROLS \
+        RMOD_SC_FILTERS, \
+        COMBO("detect", "Detector mode", "Detector", 0, ringmod_sc_detect_modes), \
+        LOG_CONTROL("dwin", "Detector window", "Det window", U_MSEC, ringmod_sc::DETECT_WINDOW), \
+        COMBO("lkmode", "Lookahead mode", "Lk mode", 0, ringmod_sc_lookahead_modes), \
+        COMBO("ovs", "Oversampling", "Oversampling", 0, ringmod_sc_oversampling_modes), \
+        RMOD_BANDS, \
+        RMOD_PROFILE
+
+    #define RMOD_LINK_GROUP(id, name, alias, group) \
+        COMBO("lgrp" id, "Link group" name, "Link group" alias, group, ringmod_sc_link_groups)
+
     #define RMOD_METERS(id, name, alias) \
         SWITCH("ilv" id, "Input visiblity" name, "Show In" alias, 1), \
         METER_OUT_GAIN("ilm" id, "Input level meter" name, GAIN_AMP_P_60_DB), \
@@ -123,6 +232,8 @@ namespace lsp
             TRIGGER("clear", "Clear graph analysis", "Clear"),
             RMOD_METERS("", "", ""),
             MESH("mg", "Meter graphs", 1 + 1*4, ringmod_sc::TIME_MESH_SIZE + 4),
+            RMOD_SHM_LINK_EXT_MONO,
+            RMOD_EXT_CONTROLS,
 
             PORTS_END
         };
@@ -163,13 +274,246 @@ namespace lsp
             RMOD_METERS("_l", " Left", " L"),
             RMOD_METERS("_r", " Right", " R"),
             MESH("mg", "Meter graphs", 1 + 2*4, ringmod_sc::TIME_MESH_SIZE + 4),
+            RMOD_SHM_LINK_EXT_STEREO,
+            RMOD_EXT_CONTROLS,
 
             PORTS_END
         };
 
+        static const port_t ringmod_sc_5_1_ports[] =
+        {
+            // Audio ports are ordered as inputs, outputs, sidechains
+            AUDIO_INPUT("in_l", "Input Left", "In L"),
+            AUDIO_INPUT("in_r", "Input Right", "In R"),
+            AUDIO_INPUT("in_c", "Input Center", "In C"),
+            AUDIO_INPUT("in_lfe", "Input LFE", "In LFE"),
+            AUDIO_INPUT("in_sl", "Input Side Left", "In SL"),
+            AUDIO_INPUT("in_sr", "Input Side Right", "In SR"),
+            AUDIO_OUTPUT("out_l", "Output Left", "Out L"),
+            AUDIO_OUTPUT("out_r", "Output Right", "Out R"),
+            AUDIO_OUTPUT("out_c", "Output Center", "Out C"),
+            AUDIO_OUTPUT("out_lfe", "Output LFE", "Out LFE"),
+            AUDIO_OUTPUT("out_sl", "Output Side Left", "Out SL"),
+            AUDIO_OUTPUT("out_sr", "Output Side Right", "Out SR"),
+            AUDIO_SIDECHAIN("sc_l", "Sidechain input Left", "SC L"),
+            AUDIO_SIDECHAIN("sc_r", "Sidechain input Right", "SC R"),
+            AUDIO_SIDECHAIN("sc_c", "Sidechain input Center", "SC C"),
+            AUDIO_SIDECHAIN("sc_lfe", "Sidechain input LFE", "SC LFE"),
+            AUDIO_SIDECHAIN("sc_sl", "Sidechain input Side Left", "SC SL"),
+            AUDIO_SIDECHAIN("sc_sr", "Sidechain input Side Right", "SC SR"),
+            RMOD_PREMIX,
+
+            BYPASS,
+            IN_GAIN,
+            SC_GAIN,
+            OUT_GAIN,
+            SWITCH("out_in", "Output input signal", "Out In", 1),
+            SWITCH("out_sc", "Output sidechain signal", "Out SC", 1),
+
+            SWITCH("active", "Sidechain processing active", "Active", 1),
+            SWITCH("invert", "Invert sidechain processing", "Invert", 0),
+            COMBO("type", "Sidechain type", "Type", 1, ringmod_sc_surround_types),
+            PERCENTS("slink", "Stereo link", "Stereo link", 0.0f, 0.1f),
+            RMOD_LINK_GROUP("_l", " Left", " L", 1),
+            RMOD_LINK_GROUP("_r", " Right", " R", 1),
+            RMOD_LINK_GROUP("_c", " Center", " C", 1),
+            RMOD_LINK_GROUP("_lfe", " LFE", " LFE", 0),
+            RMOD_LINK_GROUP("_sl", " Side Left", " SL", 2),
+            RMOD_LINK_GROUP("_sr", " Side Right", " SR", 2),
+            CONTROL("hold", "Hold time", "Hold", U_MSEC, ringmod_sc::HOLD),
+            LOG_CONTROL("release", "Release time", "Release", U_MSEC, ringmod_sc::RELEASE),
+            CONTROL("lk", "Lookahead time", "Lookahead", U_MSEC, ringmod_sc::LOOKAHEAD),
+            CONTROL("duck", "Ducking time", "Duck", U_MSEC, ringmod_sc::DUCK),
+            CONTROL("amount", "Amount", "Amount", U_DB, ringmod_sc::AMOUNT),
+
+            SWITCH("showmx", "Show mix overlay", "Show mix bar", 0.0f),
+            AMP_GAIN10("dry", "Dry gain", "Dry", GAIN_AMP_M_INF_DB),
+            AMP_GAIN10("wet", "Wet gain", "Wet", GAIN_AMP_0_DB),
+            PERCENTS("drywet", "Dry/Wet balance", "Dry/Wet", 100.0f, 0.1f),
+
+            // Meters
+            SWITCH("pause", "Pause graph analysis", "Pause", 0.0f),
+            TRIGGER("clear", "Clear graph analysis", "Clear"),
+            RMOD_METERS("_l", " Left", " L"),
+            RMOD_METERS("_r", " Right", " R"),
+            RMOD_METERS("_c", " Center", " C"),
+            RMOD_METERS("_lfe", " LFE", " LFE"),
+            RMOD_METERS("_sl", " Side Left", " SL"),
+            RMOD_METERS("_sr", " Side Right", " SR"),
+            MESH("mg", "Meter graphs", 1 + 6*4, ringmod_sc::TIME_MESH_SIZE + 4),
+            RMOD_EXT_CONTROLS,
+
+            PORTS_END
+        };
+
+        static const port_t ringmod_sc_7_1_ports[] =
+        {
+            // Audio ports are ordered as inputs, outputs, sidechains
+            AUDIO_INPUT("in_l", "Input Left", "In L"),
+            AUDIO_INPUT("in_r", "Input Right", "In R"),
+            AUDIO_INPUT("in_c", "Input Center", "In C"),
+            AUDIO_INPUT("in_lfe", "Input LFE", "In LFE"),
+            AUDIO_INPUT("in_bl", "Input Back Left", "In BL"),
+            AUDIO_INPUT("in_br", "Input Back Right", "In BR"),
+            AUDIO_INPUT("in_sl", "Input Side Left", "In SL"),
+            AUDIO_INPUT("in_sr", "Input Side Right", "In SR"),
+            AUDIO_OUTPUT("out_l", "Output Left", "Out L"),
+            AUDIO_OUTPUT("out_r", "Output Right", "Out R"),
+            AUDIO_OUTPUT("out_c", "Output Center", "Out C"),
+            AUDIO_OUTPUT("out_lfe", "Output LFE", "Out LFE"),
+            AUDIO_OUTPUT("out_bl", "Output Back Left", "Out BL"),
+            AUDIO_OUTPUT("out_br", "Output Back Right", "Out BR"),
+            AUDIO_OUTPUT("out_sl", "Output Side Left", "Out SL"),
+            AUDIO_OUTPUT("out_sr", "Output Side Right", "Out SR"),
+            AUDIO_SIDECHAIN("sc_l", "Sidechain input Left", "SC L"),
+            AUDIO_SIDECHAIN("sc_r", "Sidechain input Right", "SC R"),
+            AUDIO_SIDECHAIN("sc_c", "Sidechain input Center", "SC C"),
+            AUDIO_SIDECHAIN("sc_lfe", "Sidechain input LFE", "SC LFE"),
+            AUDIO_SIDECHAIN("sc_bl", "Sidechain input Back Left", "SC BL"),
+            AUDIO_SIDECHAIN("sc_br", "Sidechain input Back Right", "SC BR"),
+            AUDIO_SIDECHAIN("sc_sl", "Sidechain input Side Left", "SC SL"),
+            AUDIO_SIDECHAIN("sc_sr", "Sidechain input Side Right", "SC SR"),
+            RMOD_PREMIX,
+
+            BYPASS,
+            IN_GAIN,
+            SC_GAIN,
+            OUT_GAIN,
+            SWITCH("out_in", "Output input signal", "Out In", 1),
+            SWITCH("out_sc", "Output sidechain signal", "Out SC", 1),
+
+            SWITCH("active", "Sidechain processing active", "Active", 1),
+            SWITCH("invert", "Invert sidechain processing", "Invert", 0),
+            COMBO("type", "Sidechain type", "Type", 1, ringmod_sc_surround_types),
+            PERCENTS("slink", "Stereo link", "Stereo link", 0.0f, 0.1f),
+            RMOD_LINK_GROUP("_l", " Left", " L", 1),
+            RMOD_LINK_GROUP("_r", " Right", " R", 1),
+            RMOD_LINK_GROUP("_c", " Center", " C", 1),
+            RMOD_LINK_GROUP("_lfe", " LFE", " LFE", 0),
+            RMOD_LINK_GROUP("_bl", " Back Left", " BL", 3),
+            RMOD_LINK_GROUP("_br", " Back Right", " BR", 3),
+            RMOD_LINK_GROUP("_sl", " Side Left", " SL", 2),
+            RMOD_LINK_GROUP("_sr", " Side Right", " SR", 2),
+            CONTROL("hold", "Hold time", "Hold", U_MSEC, ringmod_sc::HOLD),
+            LOG_CONTROL("release", "Release time", "Release", U_MSEC, ringmod_sc::RELEASE),
+            CONTROL("lk", "Lookahead time", "Lookahead", U_MSEC, ringmod_sc::LOOKAHEAD),
+            CONTROL("duck", "Ducking time", "Duck", U_MSEC, ringmod_sc::DUCK),
+            CONTROL("amount", "Amount", "Amount", U_DB, ringmod_sc::AMOUNT),
+
+            SWITCH("showmx", "Show mix overlay", "Show mix bar", 0.0f),
+            AMP_GAIN10("dry", "Dry gain", "Dry", GAIN_AMP_M_INF_DB),
+            AMP_GAIN10("wet", "Wet gain", "Wet", GAIN_AMP_0_DB),
+            PERCENTS("drywet", "Dry/Wet balance", "Dry/Wet", 100.0f, 0.1f),
+
+            // Meters
+            SWITCH("pause", "Pause graph analysis", "Pause", 0.0f),
+            TRIGGER("clear", "Clear graph analysis", "Clear"),
+            RMOD_METERS("_l", " Left", " L"),
+            RMOD_METERS("_r", " Right", " R"),
+            RMOD_METERS("_c", " Center", " C"),
+            RMOD_METERS("_lfe", " LFE", " LFE"),
+            RMOD_METERS("_bl", " Back Left", " BL"),
+            RMOD_METERS("_br", " Back Right", " BR"),
+            RMOD_METERS("_sl", " Side Left", " SL"),
+            RMOD_METERS("_sr", " Side Right", " SR"),
+            MESH("mg", "Meter graphs", 1 + 8*4, ringmod_sc::TIME_MESH_SIZE + 4),
+            RMOD_EXT_CONTROLS,
+
+            PORTS_END
+        };
+
+        static const port_group_item_t surround_5_1_in_group_ports[] =
+        {
+            { "in_l",       PGR_LEFT            },
+            { "in_r",       PGR_RIGHT           },
+            { "in_c",       PGR_CENTER          },
+            { "in_lfe",     PGR_LO_FREQ         },
+            { "in_sl",      PGR_SIDE_LEFT       },
+            { "in_sr",      PGR_SIDE_RIGHT      },
+            { NULL }
+        };
+
+        static const port_group_item_t surround_5_1_out_group_ports[] =
+        {
+            { "out_l",      PGR_LEFT            },
+            { "out_r",      PGR_RIGHT           },
+            { "out_c",      PGR_CENTER          },
+            { "out_lfe",    PGR_LO_FREQ         },
+            { "out_sl",     PGR_SIDE_LEFT       },
+            { "out_sr",     PGR_SIDE_RIGHT      },
+            { NULL }
+        };
+
+        static const port_group_item_t surround_5_1_sc_group_ports[] =
+        {
+            { "sc_l",       PGR_LEFT            },
+            { "sc_r",       PGR_RIGHT           },
+            { "sc_c",       PGR_CENTER          },
+            { "sc_lfe",     PGR_LO_FREQ         },
+            { "sc_sl",      PGR_SIDE_LEFT       },
+            { "sc_sr",      PGR_SIDE_RIGHT      },
+            { NULL }
+        };
+
+        static const port_group_t surround_5_1_port_groups[] =
+        {
+            { "surround_in",        "Surround Input",       GRP_5_1,    PGF_IN | PGF_MAIN,          surround_5_1_in_group_ports         },
+            { "surround_out",       "Surround Output",      GRP_5_1,    PGF_OUT | PGF_MAIN,         surround_5_1_out_group_ports        },
+            { "sidechain_in",       "Sidechain Input",      GRP_5_1,    PGF_IN | PGF_SIDECHAIN,     surround_5_1_sc_group_ports, "surround_in" },
+            PORT_GROUPS_END
+        };
+
+        static const port_group_item_t surround_7_1_in_group_ports[] =
+        {
+            { "in_l",       PGR_LEFT            },
+            { "in_r",       PGR_RIGHT           },
+            { "in_c",       PGR_CENTER          },
+            { "in_lfe",     PGR_LO_FREQ         },
+            { "in_bl",      PGR_REAR_LEFT       },
+            { "in_br",      PGR_REAR_RIGHT      },
+            { "in_sl",      PGR_SIDE_LEFT       },
+            { "in_sr",      PGR_SIDE_RIGHT      },
+            { NULL }
+        };
+
+        static const port_group_item_t surround_7_1_out_group_ports[] =
+        {
+            { "out_l",      PGR_LEFT            },
+            { "out_r",      PGR_RIGHT           },
+            { "out_c",      PGR_CENTER          },
+            { "out_lfe",    PGR_LO_FREQ         },
+            { "out_bl",     PGR_REAR_LEFT       },
+            { "out_br",     PGR_REAR_RIGHT      },
+            { "out_sl",     PGR_SIDE_LEFT       },
+            { "out_sr",     PGR_SIDE_RIGHT      },
+            { NULL }
+        };
+
+        static const port_group_item_t surround_7_1_sc_group_ports[] =
+        {
+            { "sc_l",       PGR_LEFT            },
+            { "sc_r",       PGR_RIGHT           },
+            { "sc_c",       PGR_CENTER          },
+            { "sc_lfe",     PGR_LO_FREQ         },
+            { "sc_bl",      PGR_REAR_LEFT       },
+            { "sc_br",      PGR_REAR_RIGHT      },
+            { "sc_sl",      PGR_SIDE_LEFT       },
+            { "sc_sr",      PGR_SIDE_RIGHT      },
+            { NULL }
+        };
+
+        static const port_group_t surround_7_1_port_groups[] =
+        {
+            { "surround_in",        "Surround Input",       GRP_7_1,    PGF_IN | PGF_MAIN,          surround_7_1_in_group_ports         },
+            { "surround_out",       "Surround Output",      GRP_7_1,    PGF_OUT | PGF_MAIN,         surround_7_1_out_group_ports        },
+            { "sidechain_in",       "Sidechain Input",      GRP_7_1,    PGF_IN | PGF_SIDECHAIN,     surround_7_1_sc_group_ports, "surround_in" },
+            PORT_GROUPS_END
+        };
+
         static const int plugin_classes[]       = { C_DYNAMICS, -1 };
         static const int clap_features_mono[]   = { CF_AUDIO_EFFECT, CF_UTILITY, CF_MONO, -1 };
         static const int clap_features_stereo[] = { CF_AUDIO_EFFECT, CF_UTILITY, CF_STEREO, -1 };
+        static const int clap_features_surround[] = { CF_AUDIO_EFFECT, CF_UTILITY, CF_SURROUND, -1 };
 
         const meta::bundle_t ringmod_sc_bundle =
         {
@@ -244,5 +588,69 @@ namespace lsp
         };
         LSP_REGISTER_METADATA(ringmod_sc_stereo);
 
+        const plugin_t ringmod_sc_5_1 =
+        {
+            "Ring Modulated Sidechain 5.1",
+            "Ring Modulated Sidechain 5.1",
+            "Ring Modulated SC 5.1",
+            "RMSC1X6",
+            &developers::v_sadovnikov,
+            "ringmod_sc_5_1",
+            {
+                LSP_LV2_URI("ringmod_sc_5_1"),
+                LSP_LV2UI_URI("ringmod_sc_5_1"),
+                "rm51",
+                LSP_VST3_UID("rm51  rmsc51"),
+                LSP_VST3UI_UID("rm51  rmsc51"),
+                0,
+                NULL,
+                LSP_CLAP_URI("ringmod_sc_5_1"),
+                LSP_GST_UID("ringmod_sc_5_1"),
+            },
+            LSP_PLUGINS_RINGMOD_SC_VERSION,
+            plugin_classes,
+            clap_features_surround,
+            E_DUMP_STATE | E_INLINE_DISPLAY,
+            ringmod_sc_5_1_ports,
+            "plugins/util/ringmod_sc.xml",
+            NULL,
+            surround_5_1_port_groups,
+            &ringmod_sc_bundle,
+            3
+        };
+        LSP_REGISTER_METADATA(ringmod_sc_5_1);
+
+        const plugin_t ringmod_sc_7_1 =
+        {
+            "Ring Modulated Sidechain 7.1",
+            "Ring Modulated Sidechain 7.1",
+            "Ring Modulated SC 7.1",
+            "RMSC1X8",
+            &developers::v_sadovnikov,
+            "ringmod_sc_7_1",
+            {
+                LSP_LV2_URI("ringmod_sc_7_1"),
+                LSP_LV2UI_URI("ringmod_sc_7_1"),
+                "rm71",
+                LSP_VST3_UID("rm71  rmsc71"),
+                LSP_VST3UI_UID("rm71  rmsc71"),
+                0,
+                NULL,
+                LSP_CLAP_URI("ringmod_sc_7_1"),
+                LSP_GST_UID("ringmod_sc_7_1"),
+            },
+            LSP_PLUGINS_RINGMOD_SC_VERSION,
+            plugin_classes,
+            clap_features_surround,
+            E_DUMP_STATE | E_INLINE_DISPLAY,
+            ringmod_sc_7_1_ports,
+            "plugins/util/ringmod_sc.xml",
+            NULL,
+            surround_7_1_port_groups,
+            &ringmod_sc_bundle,
+            4
+        };
+        LSP_REGISTER_METADATA(ringmod_sc_7_1);
+
     } /* namespace meta */
 } /* namespace lsp */
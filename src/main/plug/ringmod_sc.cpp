@@ -21,52 +21,495 @@
 
 #include <lsp-plug.in/common/alloc.h>
 #include <lsp-plug.in/common/debug.h>
+#include <lsp-plug.in/common/types.h>
 #include <lsp-plug.in/dsp/dsp.h>
 #include <lsp-plug.in/dsp-units/units.h>
 #include <lsp-plug.in/plug-fw/core/AudioBuffer.h>
 #include <lsp-plug.in/plug-fw/meta/func.h>
+#include <lsp-plug.in/runtime/system.h>
 #include <lsp-plug.in/shared/debug.h>
 #include <lsp-plug.in/shared/id_colors.h>
 
 #include <private/plugins/ringmod_sc.h>
+#include <private/plugins/ringmod_sc_kernels.h>
+
+#include <float.h>
+
+#ifdef PLATFORM_UNIX_COMPATIBLE
+    #include <unistd.h>
+    #include <time.h>
+#endif /* PLATFORM_UNIX_COMPATIBLE */
+
+#ifdef PLATFORM_WINDOWS
+    #include <windows.h>
+#endif /* PLATFORM_WINDOWS */
 
 namespace lsp
 {
     namespace plugins
     {
         // The size of temporary buffer for audio processing
-        static constexpr size_t BUFFER_SIZE     = 0x200;
+        static constexpr size_t BUFFER_SIZE_DFL = 0x200;
+        static constexpr size_t BUFFER_SIZE_MIN = 0x100;
+        static constexpr size_t BUFFER_SIZE_MAX = 0x1000;
+
+        // Number of UI refresh periods after the last inline display draw to keep the graphs running
+        static constexpr uint32_t IDISPLAY_TIMEOUT = 120;
+
+        // Level below which the signal is considered to be silent
+        static constexpr float SILENCE_THRESHOLD = GAIN_AMP_M_120_DB;
+
+        // Oversampling: maximum factor, the number of samples to prime the oversamplers
+        // before enabling them and the gain deviation considered to be a change
+        static constexpr size_t OVERSAMPLING_MAX = 8;
+        static constexpr size_t OVERSAMPLING_PRIME = 0x80;
+        static constexpr float OVERSAMPLING_GAIN_DELTA = GAIN_AMP_M_120_DB;
+
+        // Slope of the band crossover filters: 24 dB/oct Linkwitz-Riley
+        static constexpr size_t CROSSOVER_SLOPE = 2;
+        // Time in seconds for the crossover filters to decay to silence: several periods
+        // of the lowest split frequency
+        static constexpr float CROSSOVER_DRAIN_TIME = 0.25f;
+
+        // Oversampling modes, indexed by the value of the port
+        static const dspu::over_mode_t over_modes[] =
+        {
+            dspu::OM_NONE,
+            dspu::OM_LANCZOS_2X16BIT,
+            dspu::OM_LANCZOS_4X16BIT,
+            dspu::OM_LANCZOS_8X16BIT
+        };
+
+        //---------------------------------------------------------------------
+        // Buffer size selection
+
+        // Temporary buffers of nBufSize samples allocated by init(): vEmptyBuffer, vBuffer,
+        // vOverBuf (two buffers of OVERSAMPLING_MAX chunks), vOverProd, vBandSum and vBandEnv
+        static constexpr size_t COMMON_BUFFERS = 2 + OVERSAMPLING_MAX * 2 + 1 + 2;
+        // Temporary buffers of each channel: vIndata, vBuffer, two buffers of each band and
+        // four pre-mix buffers
+        static constexpr size_t CHANNEL_BUFFERS = 2 + meta::ringmod_sc::BANDS_MAX * 2 + 4;
+        // Host buffers of each channel: input, output, sidechain and shared memory links
+        static constexpr size_t HOST_BUFFERS = 3 + meta::ringmod_sc::LINKS_MAX;
+
+        /**
+         * Select the size of temporary buffers for audio processing so that all buffers
+         * touched while processing one chunk fit into the half of L2 cache. The other half
+         * is left for the state of filters, delays and oversamplers. Smaller chunks add the
+         * per-stage call overhead, larger chunks evict the output of one stage before the
+         * next stage reads it. The plugins.ringmod_sc.buffer_size performance test compares
+         * the selected size with the fixed sizes on the target machine.
+         *
+         * @param channels number of audio channels
+         * @return size of the buffer in samples
+         */
+        static size_t select_buffer_size(size_t channels)
+        {
+        #ifdef LSP_PLUGINS_RINGMOD_SC_BUFFER_SIZE
+            const size_t size = LSP_PLUGINS_RINGMOD_SC_BUFFER_SIZE;
+            return lsp_limit(size, BUFFER_SIZE_MIN, BUFFER_SIZE_MAX);
+        #else
+            ssize_t cache_size  = -1;
+            #if defined(PLATFORM_UNIX_COMPATIBLE) && defined(_SC_LEVEL2_CACHE_SIZE)
+                cache_size          = sysconf(_SC_LEVEL2_CACHE_SIZE);
+            #endif /* _SC_LEVEL2_CACHE_SIZE */
+            if (cache_size <= 0)
+                return BUFFER_SIZE_DFL;
+
+            // The whole layout is counted: all of it is touched when oversampling and bands are enabled
+            const size_t buffers    = COMMON_BUFFERS + (CHANNEL_BUFFERS + HOST_BUFFERS) * channels;
+            const size_t limit      = size_t(cache_size) / (2 * buffers * sizeof(float));
+
+            size_t size         = BUFFER_SIZE_MIN;
+            while (((size << 1) <= limit) && (size < BUFFER_SIZE_MAX))
+                size              <<= 1;
+
+            return size;
+        #endif /* LSP_PLUGINS_RINGMOD_SC_BUFFER_SIZE */
+        }
 
         //---------------------------------------------------------------------
         // Plugin factory
+        typedef struct plugin_settings_t
+        {
+            const meta::plugin_t   *metadata;
+            uint8_t                 channels;
+            bool                    shm_link;
+        } plugin_settings_t;
+
         static const meta::plugin_t *plugins[] =
         {
             &meta::ringmod_sc_mono,
-            &meta::ringmod_sc_stereo
+            &meta::ringmod_sc_stereo,
+            &meta::ringmod_sc_5_1,
+            &meta::ringmod_sc_7_1
+        };
+
+        static const plugin_settings_t plugin_settings[] =
+        {
+            { &meta::ringmod_sc_mono,       1,  true    },
+            { &meta::ringmod_sc_stereo,     2,  true    },
+            { &meta::ringmod_sc_5_1,        6,  false   },
+            { &meta::ringmod_sc_7_1,        8,  false   },
+
+            { NULL, 0, false }
         };
 
         static plug::Module *plugin_factory(const meta::plugin_t *meta)
         {
-            return new ringmod_sc(meta);
+            for (const plugin_settings_t *s = plugin_settings; s->metadata != NULL; ++s)
+                if (s->metadata == meta)
+                    return new ringmod_sc(s->metadata, s->channels, s->shm_link);
+            return NULL;
+        }
+
+        static plug::Factory factory(plugin_factory, plugins, 4);
+
+        //---------------------------------------------------------------------
+        // Fused stereo sidechain front-end kernels: source transform, gain,
+        // rectification and envelope follower in one pass
+
+        static inline void source_left_right(float &a, float &b, float l, float r)  { a = l; b = r; }
+        static inline void source_right_left(float &a, float &b, float l, float r)  { a = r; b = l; }
+        static inline void source_left(float &a, float &b, float l, float r)        { a = l; b = l; }
+        static inline void source_right(float &a, float &b, float l, float r)       { a = r; b = r; }
+        static inline void source_mid_side(float &a, float &b, float l, float r)    { a = (l + r) * 0.5f; b = (l - r) * 0.5f; }
+        static inline void source_side_mid(float &a, float &b, float l, float r)    { a = (l - r) * 0.5f; b = (l + r) * 0.5f; }
+        static inline void source_middle(float &a, float &b, float l, float r)      { a = (l + r) * 0.5f; b = a; }
+        static inline void source_side(float &a, float &b, float l, float r)        { a = (l - r) * 0.5f; b = a; }
+        static inline void source_min(float &a, float &b, float l, float r)         { a = lsp_min(fabsf(l), fabsf(r)); b = a; }
+        static inline void source_max(float &a, float &b, float l, float r)         { a = lsp_max(fabsf(l), fabsf(r)); b = a; }
+
+        /**
+         * Front-end kernel function: produces envelopes of both stereo channels
+         * directly from the raw sidechain signal. The result is the same as the
+         * source transform followed by the ringmod_sc_kernels::envelope_x2().
+         *
+         * @param dst destination buffers to store the envelope
+         * @param l left channel of the sidechain signal
+         * @param r right channel of the sidechain signal
+         * @param gain sidechain gain at the first sample
+         * @param dgain sidechain gain increment per sample
+         * @param tau release time constant
+         * @param hold_max hold time in samples
+         * @param peak current peak values for each channel
+         * @param hold current hold counters for each channel
+         * @param count number of samples to process
+         */
+        typedef void (* frontend_func_t)(
+            float * const *dst, const float *l, const float *r,
+            float gain, float dgain, float tau, uint32_t hold_max,
+            float *peak, uint32_t *hold,
+            size_t count);
+
+        template <void (*source)(float &, float &, float, float)>
+        static void frontend_x2(
+            float * const *dst, const float *l, const float *r,
+            float gain, float dgain, float tau, uint32_t hold_max,
+            float *peak, uint32_t *hold,
+            size_t count)
+        {
+            float * const d0    = dst[0];
+            float * const d1    = dst[1];
+            float p0            = peak[0];
+            float p1            = peak[1];
+            uint32_t h0         = hold[0];
+            uint32_t h1         = hold[1];
+
+            for (size_t j=0; j<count; ++j)
+            {
+                float a, b;
+                source(a, b, l[j], r[j]);
+
+                const float k       = gain + dgain * j;
+                d0[j]               = ringmod_sc_kernels::envelope_step(fabsf(a * k), p0, h0, hold_max, tau);
+                d1[j]               = ringmod_sc_kernels::envelope_step(fabsf(b * k), p1, h1, hold_max, tau);
+            }
+
+            peak[0]             = p0;
+            peak[1]             = p1;
+            hold[0]             = h0;
+            hold[1]             = h1;
+        }
+
+        // Indexed by the sidechain source
+        static const frontend_func_t frontend_kernels[] =
+        {
+            frontend_x2<source_left_right>,
+            frontend_x2<source_right_left>,
+            frontend_x2<source_left>,
+            frontend_x2<source_right>,
+            frontend_x2<source_mid_side>,
+            frontend_x2<source_side_mid>,
+            frontend_x2<source_middle>,
+            frontend_x2<source_side>,
+            frontend_x2<source_min>,
+            frontend_x2<source_max>
+        };
+
+        //---------------------------------------------------------------------
+        // Fused gain reduction, mixing and metering kernels
+
+        // Parameters of the apply kernel, each one is ramped linearly within the chunk
+        enum apply_param_t
+        {
+            AP_IN_GAIN,                 // Input gain
+            AP_SC_GAIN,                 // Sidechain output gain
+            AP_AMOUNT,                  // Sidechain amount
+            AP_DRY,                     // Dry signal gain
+            AP_WET,                     // Wet signal gain
+
+            AP_TOTAL
+        };
+
+        /**
+         * Apply kernel function
+         *
+         * @param out delayed sidechain signal to add (if used) on input, output signal on output
+         * @param gain sidechain envelope on input, gain reduction on output
+         * @param in delayed input signal on input, input signal with applied gain on output
+         * @param k parameter values at the first sample, see apply_param_t
+         * @param dk parameter increments per sample, see apply_param_t
+         * @param meters meter values to update: input, sidechain, gain reduction, output
+         * @param count number of samples to process
+         */
+        typedef void (* apply_func_t)(
+            float *out, float *gain, float *in,
+            const float *k, const float *dk,
+            float *meters, size_t count);
+
+        template <bool invert, bool out_in, bool out_sc, bool active>
+        static void apply_kernel(
+            float *out, float *gain, float *in,
+            const float *k, const float *dk,
+            float *meters, size_t count)
+        {
+            float in_peak       = meters[0];
+            float sc_peak       = meters[1];
+            float gain_min      = meters[2];
+            float out_peak      = meters[3];
+
+            for (size_t j=0; j<count; ++j)
+            {
+                const float amount  = k[AP_AMOUNT] + dk[AP_AMOUNT] * j;
+                const float dry     = k[AP_DRY] + dk[AP_DRY] * j;
+                const float wet     = k[AP_WET] + dk[AP_WET] * j;
+
+                const float e       = gain[j];
+                const float x       = in[j] * (k[AP_IN_GAIN] + dk[AP_IN_GAIN] * j);
+                const float g       = ringmod_sc_kernels::gain_reduction<invert>(e, amount);
+                float y             = (out_in) ?
+                                        ((active) ? ringmod_sc_kernels::mix(g, x, dry, wet) : x) :
+                                        0.0f;
+                if (out_sc)
+                    y                  += out[j] * (k[AP_SC_GAIN] + dk[AP_SC_GAIN] * j);
+
+                in_peak             = lsp_max(in_peak, fabsf(x));
+                sc_peak             = lsp_max(sc_peak, fabsf(e));
+                gain_min            = lsp_min(gain_min, fabsf(g));
+                out_peak            = lsp_max(out_peak, fabsf(y));
+
+                in[j]               = x;
+                gain[j]             = g;
+                out[j]              = y;
+            }
+
+            meters[0]           = in_peak;
+            meters[1]           = sc_peak;
+            meters[2]           = gain_min;
+            meters[3]           = out_peak;
+        }
+
+        #define APPLY_KERNEL(invert, out_in) \
+            apply_kernel<invert, out_in, false, false>, \
+            apply_kernel<invert, out_in, false, true>, \
+            apply_kernel<invert, out_in, true, false>, \
+            apply_kernel<invert, out_in, true, true>
+
+        // Indexed by: invert, output input, output sidechain, active flags
+        static const apply_func_t apply_kernels[] =
+        {
+            APPLY_KERNEL(false, false),
+            APPLY_KERNEL(false, true),
+            APPLY_KERNEL(true, false),
+            APPLY_KERNEL(true, true)
+        };
+
+        #undef APPLY_KERNEL
+
+        /**
+         * Band gain kernel function: compute gain reduction of the band from the envelope
+         *
+         * @param gain envelope of the band on input, gain reduction on output
+         * @param amount sidechain amount at the first sample
+         * @param damount sidechain amount increment per sample
+         * @param count number of samples to process
+         */
+        typedef void (* band_gain_func_t)(float *gain, float amount, float damount, size_t count);
+
+        template <bool invert>
+        static void band_gain_kernel(float *gain, float amount, float damount, size_t count)
+        {
+            for (size_t j=0; j<count; ++j)
+                gain[j]             = ringmod_sc_kernels::gain_reduction<invert>(gain[j], amount + damount * j);
+        }
+
+        /**
+         * Band mix kernel function: mix the modulated bands with the dry signal,
+         * add sidechain and reduce meter values in one pass
+         *
+         * @param out delayed sidechain signal to add (if used) on input, output signal on output
+         * @param sum sum of the modulated bands
+         * @param in input signal with applied gain
+         * @param env maximum envelope of bands
+         * @param gain minimum gain reduction of bands
+         * @param k parameter values at the first sample, see apply_param_t
+         * @param dk parameter increments per sample, see apply_param_t
+         * @param meters meter values to update: input, sidechain, gain reduction, output
+         * @param count number of samples to process
+         */
+        typedef void (* band_mix_func_t)(
+            float *out, const float *sum, const float *in,
+            const float *env, const float *gain,
+            const float *k, const float *dk,
+            float *meters, size_t count);
+
+        template <bool out_in, bool out_sc, bool active>
+        static void band_mix_kernel(
+            float *out, const float *sum, const float *in,
+            const float *env, const float *gain,
+            const float *k, const float *dk,
+            float *meters, size_t count)
+        {
+            float in_peak       = meters[0];
+            float sc_peak       = meters[1];
+            float gain_min      = meters[2];
+            float out_peak      = meters[3];
+
+            for (size_t j=0; j<count; ++j)
+            {
+                const float x       = in[j];
+                float y             = (out_in) ?
+                                        ((active) ? sum[j] * (k[AP_WET] + dk[AP_WET] * j) + x * (k[AP_DRY] + dk[AP_DRY] * j) : x) :
+                                        0.0f;
+                if (out_sc)
+                    y                  += out[j] * (k[AP_SC_GAIN] + dk[AP_SC_GAIN] * j);
+
+                in_peak             = lsp_max(in_peak, fabsf(x));
+                sc_peak             = lsp_max(sc_peak, fabsf(env[j]));
+                gain_min            = lsp_min(gain_min, fabsf(gain[j]));
+                out_peak            = lsp_max(out_peak, fabsf(y));
+
+                out[j]              = y;
+            }
+
+            meters[0]           = in_peak;
+            meters[1]           = sc_peak;
+            meters[2]           = gain_min;
+            meters[3]           = out_peak;
+        }
+
+        #define BAND_MIX_KERNEL(out_in) \
+            band_mix_kernel<out_in, false, false>, \
+            band_mix_kernel<out_in, false, true>, \
+            band_mix_kernel<out_in, true, false>, \
+            band_mix_kernel<out_in, true, true>
+
+        // Indexed by: output input, output sidechain, active flags
+        static const band_mix_func_t band_mix_kernels[] =
+        {
+            BAND_MIX_KERNEL(false),
+            BAND_MIX_KERNEL(true)
+        };
+
+        #undef BAND_MIX_KERNEL
+
+        //---------------------------------------------------------------------
+        // Shared memory link combination kernels
+
+        /**
+         * Combine two signals by taking the sample with the greatest magnitude,
+         * the sign of the sample is kept, so the result is still an audio signal
+         *
+         * @param dst destination buffer
+         * @param a first signal
+         * @param b second signal
+         * @param count number of samples to process
+         */
+        static void link_max3(float *dst, const float *a, const float *b, size_t count)
+        {
+            for (size_t i=0; i<count; ++i)
+            {
+                const float as      = a[i];
+                const float bs      = b[i];
+                dst[i]              = (fabsf(bs) > fabsf(as)) ? bs : as;
+            }
+        }
+
+        /**
+         * Combine the signal with the destination buffer by taking the sample
+         * with the greatest magnitude, the sign of the sample is kept
+         *
+         * @param dst destination buffer
+         * @param src signal to combine
+         * @param count number of samples to process
+         */
+        static void link_max2(float *dst, const float *src, size_t count)
+        {
+            for (size_t i=0; i<count; ++i)
+            {
+                const float s       = src[i];
+                if (fabsf(s) > fabsf(dst[i]))
+                    dst[i]              = s;
+            }
         }
 
-        static plug::Factory factory(plugin_factory, plugins, 2);
+        //---------------------------------------------------------------------
+        // Sidechain linking kernels
+
+        /**
+         * Raise the lower envelope of the pair to the higher one proportionally
+         * to the link amount
+         *
+         * @param a envelope of the first channel
+         * @param b envelope of the second channel
+         * @param link link amount
+         * @param count number of samples to process
+         */
+        static void link_pair(float *a, float *b, float link, size_t count)
+        {
+            for (size_t i=0; i<count; ++i)
+            {
+                const float as      = a[i];
+                const float bs      = b[i];
+                if (as < bs)
+                    a[i]                = as + (bs - as) * link;
+                else
+                    b[i]                = bs + (as - bs) * link;
+            }
+        }
 
         //---------------------------------------------------------------------
         // Implementation
-        ringmod_sc::ringmod_sc(const meta::plugin_t *meta):
-            Module(meta)
+        ringmod_sc::ringmod_sc(const meta::plugin_t *meta, size_t channels, bool shm_link):
+            Module(meta),
+            sSettingsTask(this)
         {
-            // Compute the number of audio channels by the number of inputs
-            nChannels           = 1;
-            if (strcmp(meta->uid, meta::ringmod_sc_stereo.uid) == 0)
-                nChannels           = 2;
+            nChannels           = channels;
+            bShmLink            = shm_link;
+            nBufSize            = 0;                // Selected by init() if not set before
 
             // Initialize other parameters
             vChannels           = NULL;
+            vIOBuffers          = NULL;
+            vSc                 = NULL;
+            vBandSc             = NULL;
+            vLinked             = NULL;
             vEmptyBuffer        = NULL;
             vTime               = NULL;
             vBuffer             = NULL;
+            vBandSum            = NULL;
+            vBandEnv            = NULL;
             vIDisplay           = NULL;
 
             sPremix.fInToSc     = GAIN_AMP_M_INF_DB;
@@ -76,16 +519,15 @@ namespace lsp
             sPremix.fScToIn     = GAIN_AMP_M_INF_DB;
             sPremix.fScToLink   = GAIN_AMP_M_INF_DB;
 
-            for (size_t i=0; i<2; ++i)
-            {
-                sPremix.vIn[i]      = NULL;
-                sPremix.vOut[i]     = NULL;
-                sPremix.vSc[i]      = NULL;
-                sPremix.vLink[i]    = NULL;
-                sPremix.vTmpIn[i]   = NULL;
-                sPremix.vTmpSc[i]   = NULL;
-                sPremix.vTmpLink[i] = NULL;
-            }
+            sPremix.vIn         = NULL;
+            sPremix.vOut        = NULL;
+            sPremix.vSc         = NULL;
+            sPremix.vLink       = NULL;
+            sPremix.vLinks      = NULL;
+            sPremix.vTmpIn      = NULL;
+            sPremix.vTmpSc      = NULL;
+            sPremix.vTmpLink    = NULL;
+            sPremix.vTmpComb    = NULL;
 
             sPremix.pInToSc     = NULL;
             sPremix.pInToLink   = NULL;
@@ -94,26 +536,88 @@ namespace lsp
             sPremix.pScToIn     = NULL;
             sPremix.pScToLink   = NULL;
 
+            for (size_t i=0; i<2; ++i)
+                for (size_t j=0; j<PM_TOTAL; ++j)
+                {
+                    premix_route_t *r   = &sPremix.vRoutes[i][j];
+                    r->nOp              = PM_OP_NONE;
+                    for (size_t k=0; k<PM_TOTAL; ++k)
+                    {
+                        r->vSrc[k]          = j;
+                        r->vGain[k]         = GAIN_AMP_0_DB;
+                    }
+                }
+
             nType               = SC_TYPE_EXTERNAL;
             nSource             = SC_SRC_LEFT_RIGHT;
             nLookahead          = 0;
             nDuck               = 0;
+            nLkMode             = LK_MODE_TAPS;
+            nLinkMode           = LINK_MODE_SUM;
+            nOverMode           = 0;
+            nOverTimes          = 1;
+            nOverLatency        = 0;
+            nWndTime            = 0;
+            nBands              = 1;
+            for (size_t i=0; i<meta::ringmod_sc::BANDS_MAX - 1; ++i)
+                vSplit[i]           = 0.0f;
+            nDetMode            = DET_MODE_PEAK;
+            nDetWindow          = 1;
+            nDetCapacity        = 0;
             nHold               = 0;
             fTauRelease         = 1.0f;
             fStereoLink         = 0.0f;
-            fInGain             = GAIN_AMP_0_DB;
             fOutGain            = GAIN_AMP_0_DB;
-            fScGain             = GAIN_AMP_0_DB;
-            fAmount             = GAIN_AMP_0_DB;
-            fDry                = 0.0f;
-            fWet                = GAIN_AMP_0_DB;
+            init_ramp(&sInGain, GAIN_AMP_0_DB);
+            init_ramp(&sScGain, GAIN_AMP_0_DB);
+            init_ramp(&sScOutGain, GAIN_AMP_M_INF_DB);
+            init_ramp(&sAmount, GAIN_AMP_0_DB);
+            init_ramp(&sDry, 0.0f);
+            init_ramp(&sWet, GAIN_AMP_0_DB);
+            bRampReset          = true;
             bOutIn              = true;
             bOutSc              = true;
             bActive             = true;
+            bScFilter           = false;
+            bCrossSync          = true;
             bInvert             = false;
+            bIdle               = false;
+            nIdleSamples        = 0;
             bPause              = false;
             bClear              = false;
             bUISync             = false;
+            bUIActive           = false;
+            nIDisplayAge        = 0;
+            bMetering           = false;
+            nDotPeriod          = 1;
+            nDotPhase           = 0;
+            nRefreshPeriod      = 0;
+            nRefreshCounter     = 0;
+            bProfile            = false;
+            reset_profile();
+
+            sRequest.fSampleRate    = 0.0f;
+            sRequest.fHold          = 0.0f;
+            sRequest.fRelease       = 0.0f;
+            sRequest.fLookahead     = 0.0f;
+            sRequest.fDuck          = 0.0f;
+            sRequest.fDetWindow     = 0.0f;
+            sRequest.fAmount        = 0.0f;
+            sRequest.nType          = SC_TYPE_EXTERNAL;
+            sRequest.nHpfMode       = 0;
+            sRequest.nLpfMode       = 0;
+            sRequest.fHpfFreq       = meta::ringmod_sc::HPF_DFL;
+            sRequest.fLpfFreq       = meta::ringmod_sc::LPF_DFL;
+            sRequest.nBands         = 1;
+            for (size_t i=0; i<meta::ringmod_sc::BANDS_MAX - 1; ++i)
+                sRequest.vSplit[i]      = 0.0f;
+            sRequest.nOverMode      = 0;
+            sTaskRequest            = sRequest;
+            for (size_t i=0; i<2; ++i)
+                compute_settings(&vSettings[i], &sRequest);
+            pSettings           = &vSettings[0];
+            pPending            = &vSettings[1];
+            bSettingsSync       = false;
 
             pIDisplay           = NULL;
 
@@ -128,20 +632,39 @@ namespace lsp
             pType               = NULL;
             pSource             = NULL;
             pStereoLink         = NULL;
+            pHpfMode            = NULL;
+            pHpfFreq            = NULL;
+            pLpfMode            = NULL;
+            pLpfFreq            = NULL;
+            pDetMode            = NULL;
+            pDetWindow          = NULL;
+            pBands              = NULL;
+            for (size_t i=0; i<meta::ringmod_sc::BANDS_MAX - 1; ++i)
+                pSplit[i]           = NULL;
             pHold               = NULL;
             pRelease            = NULL;
             pLookahead          = NULL;
             pDuck               = NULL;
+            pLkMode             = NULL;
+            pLinkMode           = NULL;
+            pOverMode           = NULL;
             pAmount             = NULL;
             pDry                = NULL;
             pWet                = NULL;
             pDryWet             = NULL;
             pPause              = NULL;
             pClear              = NULL;
+            pProfile            = NULL;
+            pDspLoad            = NULL;
 
             pGraphMesh          = NULL;
 
             pData               = NULL;
+            pWndData            = NULL;
+            pDetData            = NULL;
+            vOverBuf[0]         = NULL;
+            vOverBuf[1]         = NULL;
+            vOverProd           = NULL;
         }
 
         ringmod_sc::~ringmod_sc()
@@ -156,18 +679,36 @@ namespace lsp
 
             // Estimate the number of bytes to allocate
             size_t szof_channels    = align_size(sizeof(channel_t) * nChannels, OPTIMAL_ALIGN);
-            size_t buf_sz           = BUFFER_SIZE * sizeof(float);
+            size_t szof_io          = align_size(sizeof(io_buffers_t) * nChannels, OPTIMAL_ALIGN);
+            size_t szof_ptrs        = align_size(sizeof(float *) * nChannels, OPTIMAL_ALIGN);
+            size_t szof_linked      = align_size(sizeof(uint32_t) * nChannels, OPTIMAL_ALIGN);
+            nBufSize                = (nBufSize > 0) ?
+                                        lsp_limit(size_t(nBufSize), BUFFER_SIZE_MIN, BUFFER_SIZE_MAX) :
+                                        select_buffer_size(nChannels);
+            lsp_trace("Selected buffer size: %d samples", int(nBufSize));
+
+            size_t buf_sz           = nBufSize * sizeof(float);
             size_t history_sz       = meta::ringmod_sc::TIME_MESH_SIZE * sizeof(float);
+            size_t ovs_hist_sz      = align_size(OVERSAMPLING_PRIME * 2 * sizeof(float), OPTIMAL_ALIGN);
             size_t alloc            = szof_channels +
+                                      szof_io +
+                                      szof_ptrs * 9 + // vSc, vBandSc, sPremix pointers
+                                      szof_ptrs * meta::ringmod_sc::LINKS_MAX + // sPremix.vLink
+                                      szof_linked * 2 + // vLinked, sPremix.vLinks
                                       buf_sz +  // vEmptyBuffer
                                       buf_sz +  // vBuffer
                                       history_sz + // vTime
                                       history_sz + // vIDisplay
+                                      buf_sz * OVERSAMPLING_MAX * 2 + // vOverBuf
+                                      buf_sz +  // vOverProd
+                                      buf_sz * 2 + // vBandSum, vBandEnv
                                       nChannels * ( // channel_t
                                           buf_sz +  // vIndata
-                                          buf_sz    // vBuffer
+                                          buf_sz +  // vBuffer
+                                          ovs_hist_sz + // vOverHist
+                                          buf_sz * meta::ringmod_sc::BANDS_MAX * 2 // band_t
                                       ) +
-                                      nChannels * 3 * buf_sz; // sPremix buffers
+                                      nChannels * 4 * buf_sz; // sPremix buffers
 
             // Allocate memory-aligned data
             uint8_t *ptr            = alloc_aligned<uint8_t>(pData, alloc, OPTIMAL_ALIGN);
@@ -176,16 +717,41 @@ namespace lsp
 
             // Initialize pointers to channels and temporary buffer
             vChannels               = advance_ptr_bytes<channel_t>(ptr, szof_channels);
+            vIOBuffers              = advance_ptr_bytes<io_buffers_t>(ptr, szof_io);
+            vSc                     = advance_ptr_bytes<float *>(ptr, szof_ptrs);
+            vBandSc                 = advance_ptr_bytes<float *>(ptr, szof_ptrs);
+            vLinked                 = advance_ptr_bytes<uint32_t>(ptr, szof_linked);
+            sPremix.vIn             = advance_ptr_bytes<float *>(ptr, szof_ptrs);
+            sPremix.vOut            = advance_ptr_bytes<float *>(ptr, szof_ptrs);
+            sPremix.vSc             = advance_ptr_bytes<float *>(ptr, szof_ptrs);
+            sPremix.vLink           = advance_ptr_bytes<float *>(ptr, szof_ptrs * meta::ringmod_sc::LINKS_MAX);
+            sPremix.vLinks          = advance_ptr_bytes<uint32_t>(ptr, szof_linked);
+            sPremix.vTmpIn          = advance_ptr_bytes<float *>(ptr, szof_ptrs);
+            sPremix.vTmpLink        = advance_ptr_bytes<float *>(ptr, szof_ptrs);
+            sPremix.vTmpComb        = advance_ptr_bytes<float *>(ptr, szof_ptrs);
+            sPremix.vTmpSc          = advance_ptr_bytes<float *>(ptr, szof_ptrs);
             vEmptyBuffer            = advance_ptr_bytes<float>(ptr, buf_sz);
             vTime                   = advance_ptr_bytes<float>(ptr, history_sz);
             vBuffer                 = advance_ptr_bytes<float>(ptr, buf_sz);
             vIDisplay               = advance_ptr_bytes<float>(ptr, history_sz);
+            vOverBuf[0]             = advance_ptr_bytes<float>(ptr, buf_sz * OVERSAMPLING_MAX);
+            vOverBuf[1]             = advance_ptr_bytes<float>(ptr, buf_sz * OVERSAMPLING_MAX);
+            vOverProd               = advance_ptr_bytes<float>(ptr, buf_sz);
+            vBandSum                = advance_ptr_bytes<float>(ptr, buf_sz);
+            vBandEnv                = advance_ptr_bytes<float>(ptr, buf_sz);
 
             // Initialize pre-mix
             for (size_t i=0; i<nChannels; ++i)
             {
+                sPremix.vIn[i]          = NULL;
+                sPremix.vOut[i]         = NULL;
+                sPremix.vSc[i]          = NULL;
+                sPremix.vLinks[i]       = 0;
+                for (size_t k=0; k<meta::ringmod_sc::LINKS_MAX; ++k)
+                    sPremix.vLink[i * meta::ringmod_sc::LINKS_MAX + k]  = NULL;
                 sPremix.vTmpIn[i]       = advance_ptr_bytes<float>(ptr, buf_sz);
                 sPremix.vTmpLink[i]     = advance_ptr_bytes<float>(ptr, buf_sz);
+                sPremix.vTmpComb[i]     = advance_ptr_bytes<float>(ptr, buf_sz);
                 sPremix.vTmpSc[i]       = advance_ptr_bytes<float>(ptr, buf_sz);
             }
 
@@ -197,7 +763,15 @@ namespace lsp
                 c->sBypass.construct();
                 c->sInDelay.construct();
                 c->sScDelay.construct();
+                c->sScEq.construct();
                 c->sEnvDelay.construct();
+                c->sOverIn.construct();
+                c->sOverGain.construct();
+                c->sOutDelay.construct();
+                c->sDryDelay.construct();
+                c->sProdDelay.construct();
+                c->sCrossIn.construct();
+                c->sCrossSc.construct();
 
                 for (size_t j=0; j<MG_TOTAL; ++j)
                     c->vGraph[j].construct();
@@ -208,20 +782,63 @@ namespace lsp
 
                 c->fPeak                = 0.0f;
                 c->nHold                = 0;
+                c->nLinkGroup           = (nChannels > 1) ? 1 : 0;
                 for (size_t j=0; j<MG_TOTAL; ++j)
                 {
                     c->vVisible[j]          = true;
+                    c->vMetered[j]          = false;
                     c->vValues[j]           = GAIN_AMP_M_INF_DB;
                 }
+                reset_meter_dot(c);
+
+                c->sWndMax.vValue       = NULL;
+                c->sWndMax.vTime        = NULL;
+                c->sWndMax.nHead        = 0;
+                c->sWndMax.nCount       = 0;
+                c->sWndMax.nMask        = 0;
+
+                c->sDetector.vHistory   = NULL;
+                c->sDetector.fSum       = 0.0f;
+                c->sDetector.nHead      = 0;
 
                 c->vInData              = advance_ptr_bytes<float>(ptr, buf_sz);
                 c->vBuffer              = advance_ptr_bytes<float>(ptr, buf_sz);
+                c->vOverHist            = advance_ptr_bytes<float>(ptr, ovs_hist_sz);
+                c->vEnvOut              = NULL;
+                c->fOverFade            = 0.0f;
+                c->nOverHold            = 0;
+                dsp::fill_zero(c->vOverHist, OVERSAMPLING_PRIME * 2);
+
+                for (size_t j=0; j<meta::ringmod_sc::BANDS_MAX; ++j)
+                {
+                    band_t *b               = &c->vBands[j];
+
+                    b->sEnvDelay.construct();
+                    b->fPeak                = 0.0f;
+                    b->nHold                = 0;
+
+                    b->sWndMax.vValue       = NULL;
+                    b->sWndMax.vTime        = NULL;
+                    b->sWndMax.nHead        = 0;
+                    b->sWndMax.nCount       = 0;
+                    b->sWndMax.nMask        = 0;
+
+                    b->sDetector.vHistory   = NULL;
+                    b->sDetector.fSum       = 0.0f;
+                    b->sDetector.nHead      = 0;
+
+                    b->vIn                  = advance_ptr_bytes<float>(ptr, buf_sz);
+                    b->vEnv                 = advance_ptr_bytes<float>(ptr, buf_sz);
+                }
 
                 // Initialize fields
                 c->pIn                  = NULL;
                 c->pOut                 = NULL;
                 c->pScIn                = NULL;
-                c->pShmIn               = NULL;
+                for (size_t k=0; k<meta::ringmod_sc::LINKS_MAX; ++k)
+                    c->vShmIn[k]            = NULL;
+                c->pEnvOut              = NULL;
+                c->pLinkGroup           = NULL;
 
                 for (size_t j=0; j<MG_TOTAL; ++j)
                 {
@@ -230,6 +847,32 @@ namespace lsp
                 }
             }
 
+            // Initialize sidechain filters, crossovers and oversamplers, the gain reduction is never downsampled
+            for (size_t i=0; i < nChannels; ++i)
+            {
+                channel_t *c            = &vChannels[i];
+                if (!c->sScEq.init(2, 12))
+                    return;
+                c->sScEq.set_mode(dspu::EQM_IIR);
+
+                if (!c->sCrossIn.init(meta::ringmod_sc::BANDS_MAX, nBufSize))
+                    return;
+                if (!c->sCrossSc.init(meta::ringmod_sc::BANDS_MAX, nBufSize))
+                    return;
+                for (size_t j=0; j<meta::ringmod_sc::BANDS_MAX; ++j)
+                {
+                    c->sCrossIn.set_handler(j, split_input, c, NULL);
+                    c->sCrossSc.set_handler(j, split_sidechain, c, NULL);
+                }
+
+                if (!c->sOverIn.init())
+                    return;
+                if (!c->sOverGain.init())
+                    return;
+                c->sOverIn.set_filtering(true);
+                c->sOverGain.set_filtering(false);
+            }
+
             // Bind ports
             lsp_trace("Binding ports");
             size_t port_id      = 0;
@@ -246,10 +889,13 @@ namespace lsp
             for (size_t i=0; i<nChannels; ++i)
                 BIND_PORT(vChannels[i].pScIn);
 
-            // Bind stereo link
-            SKIP_PORT("Stereo link name");
-            for (size_t i=0; i<nChannels; ++i)
-                BIND_PORT(vChannels[i].pShmIn);
+            // Bind shared memory link
+            if (bShmLink)
+            {
+                SKIP_PORT("Shared memory link name");
+                for (size_t i=0; i<nChannels; ++i)
+                    BIND_PORT(vChannels[i].vShmIn[0]);
+            }
 
             // Pre-mixing ports
             lsp_trace("Binding pre-mix ports");
@@ -271,10 +917,14 @@ namespace lsp
             BIND_PORT(pActive);
             BIND_PORT(pInvert);
             BIND_PORT(pType);
-            if (nChannels > 1)
-            {
+            if (nChannels == 2)
                 BIND_PORT(pSource);
+            if (nChannels > 1)
                 BIND_PORT(pStereoLink);
+            if (nChannels > 2)
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                    BIND_PORT(vChannels[i].pLinkGroup);
             }
             BIND_PORT(pHold);
             BIND_PORT(pRelease);
@@ -300,8 +950,41 @@ namespace lsp
 
             BIND_PORT(pGraphMesh);
 
+            // Bind ports added after the first release, they follow all other ports
+            lsp_trace("Binding extension ports");
+            if (bShmLink)
+            {
+                for (size_t k=1; k<meta::ringmod_sc::LINKS_MAX; ++k)
+                {
+                    SKIP_PORT("Shared memory link name");
+                    for (size_t i=0; i<nChannels; ++i)
+                        BIND_PORT(vChannels[i].vShmIn[k]);
+                }
+                BIND_PORT(pLinkMode);
+
+                SKIP_PORT("Shared memory envelope send name");
+                for (size_t i=0; i<nChannels; ++i)
+                    BIND_PORT(vChannels[i].pEnvOut);
+            }
+
+            BIND_PORT(pHpfMode);
+            BIND_PORT(pHpfFreq);
+            BIND_PORT(pLpfMode);
+            BIND_PORT(pLpfFreq);
+            BIND_PORT(pDetMode);
+            BIND_PORT(pDetWindow);
+            BIND_PORT(pLkMode);
+            BIND_PORT(pOverMode);
+            BIND_PORT(pBands);
+            for (size_t i=0; i<meta::ringmod_sc::BANDS_MAX - 1; ++i)
+                BIND_PORT(pSplit[i]);
+
+            // Bind DSP load measurement
+            BIND_PORT(pProfile);
+            BIND_PORT(pDspLoad);
+
             // Initialize buffers
-            dsp::fill_zero(vEmptyBuffer, BUFFER_SIZE);
+            dsp::fill_zero(vEmptyBuffer, nBufSize);
 
             float delta = meta::ringmod_sc::TIME_HISTORY_MAX / (meta::ringmod_sc::TIME_MESH_SIZE - 1);
             for (size_t i=0; i<meta::ringmod_sc::TIME_MESH_SIZE; ++i)
@@ -326,7 +1009,17 @@ namespace lsp
                     c->sBypass.destroy();
                     c->sInDelay.destroy();
                     c->sScDelay.destroy();
+                    c->sScEq.destroy();
                     c->sEnvDelay.destroy();
+                    c->sOverIn.destroy();
+                    c->sOverGain.destroy();
+                    c->sOutDelay.destroy();
+                    c->sDryDelay.destroy();
+                    c->sProdDelay.destroy();
+                    c->sCrossIn.destroy();
+                    c->sCrossSc.destroy();
+                    for (size_t j=0; j<meta::ringmod_sc::BANDS_MAX; ++j)
+                        c->vBands[j].sEnvDelay.destroy();
 
                     for (size_t j=0; j<MG_TOTAL; ++j)
                         c->vGraph[j].destroy();
@@ -334,7 +1027,13 @@ namespace lsp
                 vChannels   = NULL;
             }
 
+            vIOBuffers  = NULL;
+            vSc         = NULL;
+            vBandSc     = NULL;
+            vLinked     = NULL;
             vBuffer     = NULL;
+            vBandSum    = NULL;
+            vBandEnv    = NULL;
 
             // Free previously allocated data chunk
             if (pData != NULL)
@@ -342,6 +1041,16 @@ namespace lsp
                 free_aligned(pData);
                 pData       = NULL;
             }
+            if (pWndData != NULL)
+            {
+                free_aligned(pWndData);
+                pWndData    = NULL;
+            }
+            if (pDetData != NULL)
+            {
+                free_aligned(pDetData);
+                pDetData    = NULL;
+            }
 
             if (pIDisplay != NULL)
             {
@@ -353,10 +1062,68 @@ namespace lsp
         void ringmod_sc::update_sample_rate(long sr)
         {
             const size_t samples_per_dot    = dspu::seconds_to_samples(sr, meta::ringmod_sc::TIME_HISTORY_MAX / meta::ringmod_sc::TIME_MESH_SIZE);
-            const size_t in_max_delay = dspu::millis_to_samples(sr, meta::ringmod_sc::LOOKAHEAD_MAX) + BUFFER_SIZE;
+            const size_t in_max_delay = dspu::millis_to_samples(sr, meta::ringmod_sc::LOOKAHEAD_MAX) + nBufSize;
             const size_t sc_max_delay =
                 in_max_delay +
                 dspu::millis_to_samples(sr, meta::ringmod_sc::DUCK_MAX);
+            const size_t wnd_max      =
+                dspu::millis_to_samples(sr, meta::ringmod_sc::LOOKAHEAD_MAX) +
+                dspu::millis_to_samples(sr, meta::ringmod_sc::DUCK_MAX) + 1;
+
+            nDotPeriod              = lsp_max(samples_per_dot, size_t(1));
+            nDotPhase               = 0;
+            nRefreshPeriod          = dspu::seconds_to_samples(sr, 1.0f / meta::ringmod_sc::REFRESH_RATE);
+            nRefreshCounter         = nRefreshPeriod;
+            reset_profile();
+
+            // Re-allocate the running maximum buffers, the capacity should be power of 2
+            size_t wnd_cap          = 1;
+            while (wnd_cap < wnd_max)
+                wnd_cap               <<= 1;
+            const size_t wnd_val_sz = align_size(wnd_cap * sizeof(float), OPTIMAL_ALIGN);
+            const size_t wnd_time_sz= align_size(wnd_cap * sizeof(uint32_t), OPTIMAL_ALIGN);
+
+            if (pWndData != NULL)
+            {
+                free_aligned(pWndData);
+                pWndData                = NULL;
+            }
+            // Each channel and each band of the channel has it's own running maximum and detector
+            const size_t wnd_count  = nChannels * (meta::ringmod_sc::BANDS_MAX + 1);
+            uint8_t *ptr            = alloc_aligned<uint8_t>(pWndData, (wnd_val_sz + wnd_time_sz) * wnd_count, OPTIMAL_ALIGN);
+            nWndTime                = 0;
+
+            // Re-allocate the detector history buffers
+            const size_t det_max    = dspu::millis_to_samples(sr, meta::ringmod_sc::DETECT_WINDOW_MAX) + 1;
+            const size_t det_sz     = align_size(det_max * sizeof(float), OPTIMAL_ALIGN);
+            if (pDetData != NULL)
+            {
+                free_aligned(pDetData);
+                pDetData                = NULL;
+            }
+            uint8_t *det_ptr        = alloc_aligned<uint8_t>(pDetData, det_sz * wnd_count, OPTIMAL_ALIGN);
+            nDetCapacity            = (det_ptr != NULL) ? det_max : 0;
+            nDetWindow              = lsp_min(nDetWindow, lsp_max(nDetCapacity, uint32_t(1)));
+
+            // Estimate the maximum latency introduced by the oversampling
+            size_t ovs_max_delay    = 0;
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c    = &vChannels[i];
+                c->sOverIn.set_sample_rate(sr);
+                c->sOverGain.set_sample_rate(sr);
+            }
+            if (nChannels > 0)
+            {
+                dspu::Oversampler *os   = &vChannels[0].sOverIn;
+                for (size_t i=1; i<sizeof(over_modes)/sizeof(over_modes[0]); ++i)
+                {
+                    os->set_mode(over_modes[i]);
+                    os->update_settings();
+                    ovs_max_delay           = lsp_max(ovs_max_delay, os->latency());
+                }
+            }
+            ovs_max_delay          += nBufSize;
 
             // Update sample rate for the bypass processors
             for (size_t i=0; i<nChannels; ++i)
@@ -365,171 +1132,723 @@ namespace lsp
                 c->sBypass.init(sr);
                 c->sInDelay.init(in_max_delay);
                 c->sScDelay.init(in_max_delay);
+                c->sScEq.set_sample_rate(sr);
+                c->sCrossIn.set_sample_rate(sr);
+                c->sCrossSc.set_sample_rate(sr);
                 c->sEnvDelay.init(sc_max_delay);
+                bCrossSync      = true;
+                c->sOutDelay.init(ovs_max_delay);
+                c->sDryDelay.init(ovs_max_delay);
+                c->sProdDelay.init(ovs_max_delay);
+
+                window_max_t *w         = &c->sWndMax;
+                w->vValue               = (ptr != NULL) ? advance_ptr_bytes<float>(ptr, wnd_val_sz) : NULL;
+                w->vTime                = (ptr != NULL) ? advance_ptr_bytes<uint32_t>(ptr, wnd_time_sz) : NULL;
+                w->nHead                = 0;
+                w->nCount               = 0;
+                w->nMask                = (ptr != NULL) ? wnd_cap - 1 : 0;
+
+                c->sDetector.vHistory   = (det_ptr != NULL) ? advance_ptr_bytes<float>(det_ptr, det_sz) : NULL;
+
+                for (size_t j=0; j<meta::ringmod_sc::BANDS_MAX; ++j)
+                {
+                    band_t *b               = &c->vBands[j];
+                    b->sEnvDelay.init(sc_max_delay);
+
+                    w                       = &b->sWndMax;
+                    w->vValue               = (ptr != NULL) ? advance_ptr_bytes<float>(ptr, wnd_val_sz) : NULL;
+                    w->vTime                = (ptr != NULL) ? advance_ptr_bytes<uint32_t>(ptr, wnd_time_sz) : NULL;
+                    w->nHead                = 0;
+                    w->nCount               = 0;
+                    w->nMask                = (ptr != NULL) ? wnd_cap - 1 : 0;
+
+                    b->sDetector.vHistory   = (det_ptr != NULL) ? advance_ptr_bytes<float>(det_ptr, det_sz) : NULL;
+                }
 
                 for (size_t j=0; j<MG_TOTAL; ++j)
                 {
                     const float dfl = (j == MG_GAIN) ? GAIN_AMP_0_DB : GAIN_AMP_M_INF_DB;
-                    c->vGraph[j].init(meta::ringmod_sc::TIME_MESH_SIZE, samples_per_dot, dfl);
-                    c->vGraph[j].set_period(samples_per_dot);
+                    c->vGraph[j].init(meta::ringmod_sc::TIME_MESH_SIZE, 1, dfl);
+                    c->vGraph[j].set_period(1);
                 }
+                reset_meter_dot(c);
             }
+
+            reset_detectors();
+            reset_bands();
+            update_oversampling();
+
+            // Recompute the settings snapshot for the new sample rate immediately,
+            // the snapshot being computed by the task will be discarded
+            sRequest.fSampleRate    = sr;
+            compute_settings(pSettings, &sRequest);
+            apply_settings(pSettings);
         }
 
-        void ringmod_sc::update_premix()
+        void ringmod_sc::compute_settings(settings_t *dst, const settings_request_t *req)
         {
-            sPremix.fInToSc     = (sPremix.pInToSc != NULL)     ? sPremix.pInToSc->value()      : GAIN_AMP_M_INF_DB;
-            sPremix.fInToLink   = (sPremix.pInToLink != NULL)   ? sPremix.pInToLink->value()    : GAIN_AMP_M_INF_DB;
-            sPremix.fLinkToIn   = (sPremix.pLinkToIn != NULL)   ? sPremix.pLinkToIn->value()    : GAIN_AMP_M_INF_DB;
-            sPremix.fLinkToSc   = (sPremix.pLinkToSc != NULL)   ? sPremix.pLinkToSc->value()    : GAIN_AMP_M_INF_DB;
-            sPremix.fScToIn     = (sPremix.pScToIn != NULL)     ? sPremix.pScToIn->value()      : GAIN_AMP_M_INF_DB;
-            sPremix.fScToLink   = (sPremix.pScToLink != NULL)   ? sPremix.pScToLink->value()    : GAIN_AMP_M_INF_DB;
+            const float sr          = req->fSampleRate;
+
+            dst->fTauRelease        = ringmod_sc_kernels::release_tau(sr, req->fRelease);
+            dst->fAmount            = dspu::db_to_gain(req->fAmount);
+            dst->nHold              = dspu::millis_to_samples(sr, req->fHold);
+            dst->nLookahead         = dspu::millis_to_samples(sr, req->fLookahead);
+            dst->nDuck              = dst->nLookahead + dspu::millis_to_samples(sr, req->fDuck);
+            dst->nDetWindow         = dspu::millis_to_samples(sr, req->fDetWindow);
+
+            // The received envelope is always full-band, oversampling is not applied in the multiband mode
+            const size_t max_ovs_mode   = sizeof(over_modes)/sizeof(over_modes[0]) - 1;
+            dst->nType              = req->nType;
+            dst->nBands             = (req->nType == SC_TYPE_ENVELOPE) ? 1 :
+                                      lsp_limit(req->nBands, uint32_t(1), uint32_t(meta::ringmod_sc::BANDS_MAX));
+            dst->nOverMode          = (dst->nBands <= 1) ? lsp_min(size_t(req->nOverMode), max_ovs_mode) : 0;
+
+            // Sidechain filters
+            const size_t hp_slope   = req->nHpfMode * 2;
+            const size_t lp_slope   = req->nLpfMode * 2;
+            dspu::filter_params_t *hpf  = &dst->sHpf;
+            dspu::filter_params_t *lpf  = &dst->sLpf;
+
+            hpf->nType              = (hp_slope > 0) ? dspu::FLT_BT_BWC_HIPASS : dspu::FLT_NONE;
+            hpf->fFreq              = req->fHpfFreq;
+            hpf->fFreq2             = hpf->fFreq;
+            hpf->fGain              = GAIN_AMP_0_DB;
+            hpf->nSlope             = hp_slope;
+            hpf->fQuality           = 0.0f;
+
+            lpf->nType              = (lp_slope > 0) ? dspu::FLT_BT_BWC_LOPASS : dspu::FLT_NONE;
+            lpf->fFreq              = req->fLpfFreq;
+            lpf->fFreq2             = lpf->fFreq;
+            lpf->fGain              = GAIN_AMP_0_DB;
+            lpf->nSlope             = lp_slope;
+            lpf->fQuality           = 0.0f;
+
+            dst->bScFilter          = (hp_slope > 0) || (lp_slope > 0);
+
+            // Split frequencies of the active bands should go in ascending order
+            float * const split     = dst->vSplit;
+            for (size_t i=0; i<meta::ringmod_sc::BANDS_MAX - 1; ++i)
+                split[i]                = req->vSplit[i];
+            for (size_t i=1; i<dst->nBands - 1; ++i)
+                for (size_t j=i; (j > 0) && (split[j-1] > split[j]); --j)
+                    lsp::swap(split[j-1], split[j]);
         }
 
-        void ringmod_sc::update_settings()
+        void ringmod_sc::apply_settings(const settings_t *s)
         {
-            const bool bypass       = pBypass->value() >= 0.5f;
-
-            // Update pre-mix matrix
-            update_premix();
-
-            // Update sidechain processing
-            nType                   = pType->value();
-            nSource                 = (pSource != NULL) ? uint32_t(pSource->value()) : uint32_t(SC_SRC_LEFT_RIGHT);
-            fStereoLink             = (pStereoLink != NULL) ? lsp_max(pStereoLink->value() * 0.01f, 0.0f) : 0.0f;
-            nHold                   = dspu::millis_to_samples(fSampleRate, pHold->value());
-            const float release     = pRelease->value();
-            fTauRelease             = 1.0f - expf(logf(1.0f - M_SQRT1_2) / (dspu::millis_to_samples(fSampleRate, release)));
-            nLookahead              = dspu::millis_to_samples(fSampleRate, pLookahead->value());
-            nDuck                   = nLookahead + dspu::millis_to_samples(fSampleRate, pDuck->value());
+            fTauRelease             = s->fTauRelease;
+            sAmount.fTarget         = s->fAmount;
+            nHold                   = s->nHold;
+            nLookahead              = s->nLookahead;
+            nDuck                   = s->nDuck;
+
+            // The running sums become invalid when the window changes
+            const uint32_t det_wnd  = lsp_limit(s->nDetWindow, uint32_t(1), lsp_max(nDetCapacity, uint32_t(1)));
+            if (det_wnd != nDetWindow)
+            {
+                nDetWindow              = det_wnd;
+                reset_detectors();
+            }
 
             for (size_t i=0; i<nChannels; ++i)
             {
                 channel_t *c            = &vChannels[i];
-
-                c->sBypass.set_bypass(bypass);
                 c->sInDelay.set_delay(nLookahead);
                 c->sScDelay.set_delay(nLookahead);
+            }
 
-                for (size_t j=0; j<MG_TOTAL; ++j)
-                    c->vVisible[j]          = c->vVisibility[j]->value() >= 0.5f;
+            // The sidechain type and the number of bands are switched together
+            nType                   = s->nType;
+            if (s->nBands != nBands)
+            {
+                nBands                  = s->nBands;
+                bCrossSync              = true;
+                reset_bands();
+            }
+            for (size_t i=0; i<meta::ringmod_sc::BANDS_MAX - 1; ++i)
+            {
+                if (vSplit[i] == s->vSplit[i])
+                    continue;
+                vSplit[i]               = s->vSplit[i];
+                bCrossSync              = true;
             }
 
-            // Compute Dry/Wet balance
-            const float out_gain    = pGainOut->value();
-            const float dry_gain    = pDry->value();
-            const float wet_gain    = pWet->value();
-            const float drywet      = pDryWet->value() * 0.01f;
-            const float sc_gain     = pGainSc->value();
+            // Apply the crossover parameters when they change. The crossovers own the state of
+            // the filters used by the processing thread, so they are rebuilt here
+            for (size_t i=0; (bCrossSync) && (i<nChannels); ++i)
+            {
+                channel_t *c            = &vChannels[i];
+                for (size_t j=0; j<meta::ringmod_sc::BANDS_MAX - 1; ++j)
+                {
+                    const size_t slope      = (j + 1 < nBands) ? CROSSOVER_SLOPE : 0;
+                    c->sCrossIn.set_frequency(j, vSplit[j]);
+                    c->sCrossIn.set_slope(j, slope);
+                    c->sCrossIn.set_mode(j, dspu::CROSS_MODE_BT);
+                    c->sCrossSc.set_frequency(j, vSplit[j]);
+                    c->sCrossSc.set_slope(j, slope);
+                    c->sCrossSc.set_mode(j, dspu::CROSS_MODE_BT);
+                }
+                c->sCrossIn.reconfigure();
+                c->sCrossSc.reconfigure();
+            }
+            bCrossSync              = false;
 
-            fInGain                 = pGainIn->value();
-            fOutGain                = out_gain;
-            fScGain                 = sc_gain;
-            fAmount                 = dspu::db_to_gain(pAmount->value());
-            fDry                    = (dry_gain * drywet + 1.0f - drywet) * out_gain;
-            fWet                    = wet_gain * drywet * out_gain;
-            bOutIn                  = pOutIn->value() >= 0.5f;
-            bOutSc                  = pOutSc->value() >= 0.5f;
-            bPause                  = pPause->value() >= 0.5f;
-            if (pClear->value() >= 0.5f)
-                bClear                  = true;
-            bActive                 = pActive->value() >= 0.5f;
-            bInvert                 = pInvert->value() >= 0.5f;
+            // Apply the sidechain filters, the equalizer rebuilds them on the next call of process()
+            bScFilter               = s->bScFilter;
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                dspu::Equalizer *eq     = &vChannels[i].sScEq;
+                eq->set_params(0, &s->sHpf);
+                eq->set_params(1, &s->sLpf);
+                eq->set_mode((bScFilter) ? dspu::EQM_IIR : dspu::EQM_BYPASS);
+            }
+
+            // Apply oversampling
+            if (s->nOverMode != nOverMode)
+            {
+                nOverMode               = s->nOverMode;
+                update_oversampling();
+            }
 
             // Report latency
-            set_latency(nLookahead);
+            set_latency(nLookahead + nOverLatency);
         }
 
-        void ringmod_sc::ui_activated()
+        void ringmod_sc::sync_settings()
         {
-            bUISync                 = true;
+            // Apply the snapshot computed by the task. The task does not touch the snapshot
+            // after completion, so both snapshots are owned by the processing thread until
+            // the next submission. With the executor the snapshot is applied at the start
+            // of the first block after the task completes, so the settings land at least
+            // one block after update_settings().
+            if (sSettingsTask.completed())
+            {
+                if ((sSettingsTask.successful()) && (sTaskRequest.fSampleRate == fSampleRate))
+                {
+                    lsp::swap(pSettings, pPending);
+                    apply_settings(pSettings);
+                }
+                else
+                    bSettingsSync           = true;
+                sSettingsTask.reset();
+            }
+
+            if ((!bSettingsSync) || (!sSettingsTask.idle()))
+                return;
+
+            // Compute the snapshot in place if there is no background executor
+            ipc::IExecutor *executor    = (pWrapper != NULL) ? pWrapper->executor() : NULL;
+            if (executor == NULL)
+            {
+                compute_settings(pSettings, &sRequest);
+                apply_settings(pSettings);
+                bSettingsSync           = false;
+                return;
+            }
+
+            // Submit the request, retry on the next block if the executor is busy
+            sTaskRequest            = sRequest;
+            if (executor->submit(&sSettingsTask))
+                bSettingsSync           = false;
         }
 
-        void ringmod_sc::premix_channels(io_buffers_t * io_buf, size_t samples)
+        void ringmod_sc::update_oversampling()
         {
+            const dspu::over_mode_t mode    = over_modes[nOverMode];
+
             for (size_t i=0; i<nChannels; ++i)
             {
-                io_buffers_t * const io = &io_buf[i];
+                channel_t *c            = &vChannels[i];
 
-                // Get pointers to buffers and advance position
-                float * const in_buf    = sPremix.vIn[i];
-                float * const out_buf   = sPremix.vOut[i];
-                float * const sc_buf    = sPremix.vSc[i];
-                float * const link_buf  = sPremix.vLink[i];
+                c->sOverIn.set_mode(mode);
+                c->sOverGain.set_mode(mode);
+                if (c->sOverIn.modified())
+                    c->sOverIn.update_settings();
+                if (c->sOverGain.modified())
+                    c->sOverGain.update_settings();
 
-                io->vIn              = in_buf;
-                io->vOut             = out_buf;
-                io->vScIn            = sc_buf;
-                io->vShmIn           = link_buf;
+                // The oversamplers need to be primed before enabling again
+                c->fOverFade            = 0.0f;
+                c->nOverHold            = 0;
+            }
 
-                // Update pointers
-                sPremix.vIn[i]    = &in_buf[samples];
-                sPremix.vOut[i]   = &out_buf[samples];
-                sPremix.vSc[i]    = &sc_buf[samples];
-                if (link_buf != NULL)
-                    sPremix.vLink[i]  = &link_buf[samples];
-
-                // Perform transformation
-                // (Sc, Link) -> In
-                if ((sc_buf != NULL) && (sPremix.fScToIn > GAIN_AMP_M_INF_DB))
-                {
-                    io->vIn               = sPremix.vTmpIn[i];
-                    dsp::fmadd_k4(io->vIn, in_buf, sc_buf, sPremix.fScToIn, samples);
+            nOverTimes              = (nChannels > 0) ? vChannels[0].sOverIn.get_oversampling() : 1;
+            nOverLatency            = ((nOverMode > 0) && (nChannels > 0)) ? vChannels[0].sOverIn.latency() : 0;
 
-                    if ((link_buf != NULL) && (sPremix.fLinkToIn > GAIN_AMP_M_INF_DB))
-                        dsp::fmadd_k3(io->vIn, link_buf, sPremix.fLinkToIn, samples);
-                }
-                else if ((link_buf != NULL) && (sPremix.fLinkToIn > GAIN_AMP_M_INF_DB))
-                {
-                    io->vIn               = sPremix.vTmpIn[i];
-                    dsp::fmadd_k4(io->vIn, in_buf, link_buf, sPremix.fLinkToIn, samples);
-                }
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c            = &vChannels[i];
+                c->sOutDelay.set_delay(nOverLatency);
+                c->sDryDelay.set_delay(nOverLatency);
+                c->sProdDelay.set_delay(nOverLatency);
+            }
+        }
 
-                // (In, Link) -> Sc
-                if (sPremix.fInToSc > GAIN_AMP_M_INF_DB)
-                {
-                    io->vScIn             = sPremix.vTmpSc[i];
-                    if (sc_buf != NULL)
-                        dsp::fmadd_k4(io->vScIn, sc_buf, in_buf, sPremix.fInToSc, samples);
-                    else
-                        dsp::mul_k3(io->vScIn, in_buf, sPremix.fInToSc, samples);
+        void ringmod_sc::update_premix()
+        {
+            sPremix.fInToSc     = (sPremix.pInToSc != NULL)     ? sPremix.pInToSc->value()      : GAIN_AMP_M_INF_DB;
+            sPremix.fInToLink   = (sPremix.pInToLink != NULL)   ? sPremix.pInToLink->value()    : GAIN_AMP_M_INF_DB;
+            sPremix.fLinkToIn   = (sPremix.pLinkToIn != NULL)   ? sPremix.pLinkToIn->value()    : GAIN_AMP_M_INF_DB;
+            sPremix.fLinkToSc   = (sPremix.pLinkToSc != NULL)   ? sPremix.pLinkToSc->value()    : GAIN_AMP_M_INF_DB;
+            sPremix.fScToIn     = (sPremix.pScToIn != NULL)     ? sPremix.pScToIn->value()      : GAIN_AMP_M_INF_DB;
+            sPremix.fScToLink   = (sPremix.pScToLink != NULL)   ? sPremix.pScToLink->value()    : GAIN_AMP_M_INF_DB;
 
-                    if ((link_buf != NULL) && (sPremix.fLinkToSc > GAIN_AMP_M_INF_DB))
-                        dsp::fmadd_k3(io->vScIn, link_buf, sPremix.fLinkToSc, samples);
-                }
-                else if ((link_buf != NULL) && (sPremix.fLinkToSc > GAIN_AMP_M_INF_DB))
-                {
-                    io->vScIn             = sPremix.vTmpSc[i];
-                    if (sc_buf != NULL)
-                        dsp::fmadd_k4(io->vScIn, sc_buf, link_buf, sPremix.fLinkToSc, samples);
-                    else
-                        dsp::mul_k3(io->vScIn, link_buf, sPremix.fLinkToSc, samples);
-                }
+            // Routing matrix: matrix[dst][src], the bus always passes itself
+            const float matrix[PM_TOTAL][PM_TOTAL] =
+            {
+                { GAIN_AMP_0_DB,        sPremix.fScToIn,        sPremix.fLinkToIn   },
+                { sPremix.fInToSc,      GAIN_AMP_0_DB,          sPremix.fLinkToSc   },
+                { sPremix.fInToLink,    sPremix.fScToLink,      GAIN_AMP_0_DB       }
+            };
 
-                // (In, Sc) -> Link
-                if (sPremix.fInToLink > GAIN_AMP_M_INF_DB)
-                {
-                    io->vShmIn            = sPremix.vTmpLink[i];
-                    if (link_buf != NULL)
-                        dsp::fmadd_k4(io->vShmIn, link_buf, in_buf, sPremix.fInToLink, samples);
-                    else
-                        dsp::mul_k3(io->vShmIn, in_buf, sPremix.fInToLink, samples);
+            // Compile routes for the case when the link is absent and present
+            for (size_t link=0; link<2; ++link)
+            {
+                const size_t buses  = (link) ? PM_TOTAL : PM_LINK;
 
-                    if ((sc_buf != NULL) && (sPremix.fScToLink > GAIN_AMP_M_INF_DB))
-                        dsp::fmadd_k3(io->vShmIn, sc_buf, sPremix.fScToLink, samples);
-                }
-                else if ((sc_buf != NULL) && (sPremix.fScToLink > GAIN_AMP_M_INF_DB))
+                for (size_t dst=0; dst<PM_TOTAL; ++dst)
                 {
-                    io->vShmIn            = sPremix.vTmpLink[i];
-                    if (link_buf != NULL)
-                        dsp::fmadd_k4(io->vShmIn, link_buf, sc_buf, sPremix.fScToLink, samples);
+                    premix_route_t *r   = &sPremix.vRoutes[link][dst];
+                    size_t n            = 0;
+
+                    // Drop all silent routes
+                    for (size_t src=0; src<buses; ++src)
+                    {
+                        const float gain    = matrix[dst][src];
+                        if (gain <= GAIN_AMP_M_INF_DB)
+                            continue;
+                        r->vSrc[n]          = src;
+                        r->vGain[n]         = gain;
+                        ++n;
+                    }
+
+                    // The bus with no cross-feeds is passed as is
+                    if ((n == 0) || ((n == 1) && (r->vSrc[0] == dst)))
+                        r->nOp              = PM_OP_NONE;
                     else
-                        dsp::mul_k3(io->vShmIn, sc_buf, sPremix.fScToLink, samples);
+                        r->nOp              = (n == 1) ? PM_OP_MUL :
+                                              (n == 2) ? PM_OP_MIX2 :
+                                              PM_OP_MIX3;
                 }
             }
         }
 
-        void ringmod_sc::process_sidechain_type(float **sc, io_buffers_t *io, size_t samples)
+        void ringmod_sc::init_ramp(ramp_t *r, float value)
+        {
+            r->fValue           = value;
+            r->fTarget          = value;
+            r->fDelta           = 0.0f;
+        }
+
+        void ringmod_sc::start_ramps(size_t samples)
+        {
+            ramp_t * const list[] = { &sInGain, &sScGain, &sScOutGain, &sAmount, &sDry, &sWet };
+            const float k       = (samples > 0) ? 1.0f / samples : 0.0f;
+
+            for (size_t i=0; i<sizeof(list)/sizeof(list[0]); ++i)
+            {
+                ramp_t * const r    = list[i];
+                if (bRampReset)
+                    r->fValue           = r->fTarget;
+                r->fDelta           = (r->fTarget - r->fValue) * k;
+            }
+
+            bRampReset          = false;
+        }
+
+        void ringmod_sc::advance_ramps(size_t samples)
+        {
+            ramp_t * const list[] = { &sInGain, &sScGain, &sScOutGain, &sAmount, &sDry, &sWet };
+
+            for (size_t i=0; i<sizeof(list)/sizeof(list[0]); ++i)
+                list[i]->fValue    += list[i]->fDelta * samples;
+        }
+
+        void ringmod_sc::complete_ramps()
+        {
+            ramp_t * const list[] = { &sInGain, &sScGain, &sScOutGain, &sAmount, &sDry, &sWet };
+
+            // Avoid accumulation of rounding errors between blocks
+            for (size_t i=0; i<sizeof(list)/sizeof(list[0]); ++i)
+            {
+                list[i]->fValue     = list[i]->fTarget;
+                list[i]->fDelta     = 0.0f;
+            }
+        }
+
+        void ringmod_sc::update_settings()
+        {
+            const bool bypass       = pBypass->value() >= 0.5f;
+
+            // Update pre-mix matrix
+            update_premix();
+
+            // Update sidechain processing
+            nSource                 = (pSource != NULL) ? uint32_t(pSource->value()) : uint32_t(SC_SRC_LEFT_RIGHT);
+            nLinkMode               = (pLinkMode != NULL) ? uint32_t(pLinkMode->value()) : uint32_t(LINK_MODE_SUM);
+            fStereoLink             = (pStereoLink != NULL) ? lsp_max(pStereoLink->value() * 0.01f, 0.0f) : 0.0f;
+
+            // Request computation of coefficients on the background thread
+            sRequest.fSampleRate    = fSampleRate;
+            sRequest.fHold          = pHold->value();
+            sRequest.fRelease       = pRelease->value();
+            sRequest.fLookahead     = pLookahead->value();
+            sRequest.fDuck          = pDuck->value();
+            sRequest.fDetWindow     = pDetWindow->value();
+            sRequest.fAmount        = pAmount->value();
+            sRequest.nType          = pType->value();
+            sRequest.nHpfMode       = pHpfMode->value();
+            sRequest.nLpfMode       = pLpfMode->value();
+            sRequest.fHpfFreq       = pHpfFreq->value();
+            sRequest.fLpfFreq       = pLpfFreq->value();
+            sRequest.nBands         = size_t(pBands->value()) + 1;
+            for (size_t i=0; i<meta::ringmod_sc::BANDS_MAX - 1; ++i)
+                sRequest.vSplit[i]      = pSplit[i]->value();
+            sRequest.nOverMode      = (pOverMode != NULL) ? uint32_t(pOverMode->value()) : 0;
+            bSettingsSync           = true;
+
+            // Update the detector, the running sums become invalid when the mode changes
+            const uint32_t det_mode = (nDetCapacity > 0) ? uint32_t(pDetMode->value()) : uint32_t(DET_MODE_PEAK);
+            if (det_mode != nDetMode)
+            {
+                nDetMode                = det_mode;
+                reset_detectors();
+            }
+
+            // Reset the running maximum when switching to the window mode
+            const uint32_t lk_mode  = pLkMode->value();
+            if ((lk_mode == LK_MODE_WINDOW) && (nLkMode != LK_MODE_WINDOW))
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    channel_t *c            = &vChannels[i];
+                    c->sWndMax.nHead        = 0;
+                    c->sWndMax.nCount       = 0;
+                    for (size_t j=0; j<meta::ringmod_sc::BANDS_MAX; ++j)
+                    {
+                        c->vBands[j].sWndMax.nHead  = 0;
+                        c->vBands[j].sWndMax.nCount = 0;
+                    }
+                }
+            }
+            nLkMode                 = lk_mode;
+
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c            = &vChannels[i];
+
+                c->sBypass.set_bypass(bypass);
+                if (c->pLinkGroup != NULL)
+                    c->nLinkGroup           = c->pLinkGroup->value();
+
+                for (size_t j=0; j<MG_TOTAL; ++j)
+                    c->vVisible[j]          = c->vVisibility[j]->value() >= 0.5f;
+            }
+
+            // Compute Dry/Wet balance
+            const float out_gain    = pGainOut->value();
+            const float dry_gain    = pDry->value();
+            const float wet_gain    = pWet->value();
+            const float drywet      = pDryWet->value() * 0.01f;
+            const float sc_gain     = pGainSc->value();
+
+            fOutGain                = out_gain;
+            sInGain.fTarget         = pGainIn->value();
+            sScGain.fTarget         = sc_gain;
+            sDry.fTarget            = (dry_gain * drywet + 1.0f - drywet) * out_gain;
+            sWet.fTarget            = wet_gain * drywet * out_gain;
+            bOutIn                  = pOutIn->value() >= 0.5f;
+            bOutSc                  = pOutSc->value() >= 0.5f;
+            sScOutGain.fTarget      = (bOutSc) ? sc_gain * out_gain : GAIN_AMP_M_INF_DB;
+            bPause                  = pPause->value() >= 0.5f;
+            if (pClear->value() >= 0.5f)
+                bClear                  = true;
+            bActive                 = pActive->value() >= 0.5f;
+            bInvert                 = pInvert->value() >= 0.5f;
+
+            const bool profile      = pProfile->value() >= 0.5f;
+            if (profile != bProfile)
+            {
+                bProfile                = profile;
+                reset_profile();
+            }
+
+            // The latency is reported by apply_settings() when the settings snapshot is applied
+        }
+
+        void ringmod_sc::ui_activated()
+        {
+            bUISync                 = true;
+            bUIActive               = true;
+        }
+
+        void ringmod_sc::ui_deactivated()
+        {
+            bUIActive               = false;
+        }
+
+        void ringmod_sc::update_metering()
+        {
+            const bool graphs       = (bUIActive) || (nIDisplayAge < IDISPLAY_TIMEOUT);
+            bMetering               = bUIActive;
+
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c            = &vChannels[i];
+
+                for (size_t j=0; j<MG_TOTAL; ++j)
+                {
+                    const bool metered      = (graphs) && (c->vVisible[j]);
+
+                    // The history of the graph is outdated, drop it
+                    if ((metered) && (!c->vMetered[j]))
+                        c->vGraph[j].clear();
+                    c->vMetered[j]          = metered;
+                    bMetering              |= metered;
+                }
+            }
+        }
+
+        uint64_t ringmod_sc::profile_time()
+        {
+            // Use the monotonic clock: the wall clock may be adjusted while processing
+        #if defined(PLATFORM_UNIX_COMPATIBLE) && defined(CLOCK_MONOTONIC)
+            struct timespec ts;
+            if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+                return uint64_t(ts.tv_sec) * 1000000000u + uint64_t(ts.tv_nsec);
+        #elif defined(PLATFORM_WINDOWS)
+            LARGE_INTEGER counter, freq;
+            if ((QueryPerformanceCounter(&counter)) && (QueryPerformanceFrequency(&freq)) && (freq.QuadPart > 0))
+            {
+                const uint64_t c    = counter.QuadPart;
+                const uint64_t f    = freq.QuadPart;
+                return (c / f) * 1000000000u + ((c % f) * 1000000000u) / f;
+            }
+        #endif
+            system::time_t st;
+            system::get_time(&st);
+            return uint64_t(st.seconds) * 1000000000u + uint64_t(st.nanos);
+        }
+
+        uint64_t ringmod_sc::profile_elapsed(uint64_t start, uint64_t end)
+        {
+            // The fallback clock may step backwards
+            return (end > start) ? end - start : 0;
+        }
+
+        void ringmod_sc::reset_profile()
+        {
+            for (size_t i=0; i<PS_TOTAL; ++i)
+            {
+                sProfile.vTime[i]       = 0;
+                sProfile.vPeak[i]       = 0;
+                sProfile.vCalls[i]      = 0;
+            }
+            sProfile.nLoadTime      = 0;
+            sProfile.nLoadSamples   = 0;
+            sProfile.fLoad          = 0.0f;
+        }
+
+        uint64_t ringmod_sc::profile_stage(size_t stage, uint64_t start)
+        {
+            const uint64_t now      = profile_time();
+            const uint64_t time     = profile_elapsed(start, now);
+
+            sProfile.vTime[stage]  += time;
+            sProfile.vPeak[stage]   = lsp_max(sProfile.vPeak[stage], time);
+            ++sProfile.vCalls[stage];
+
+            return now;
+        }
+
+        void ringmod_sc::update_profile(uint64_t start, size_t samples, bool refresh)
+        {
+            if (bProfile)
+            {
+                // Estimate the DSP load as the ratio of processing time to the duration of audio
+                sProfile.nLoadTime     += profile_elapsed(start, profile_time());
+                sProfile.nLoadSamples  += samples;
+                if ((refresh) && (sProfile.nLoadSamples > 0))
+                {
+                    const double duration   = double(sProfile.nLoadSamples) * 1e+9 / fSampleRate;
+                    sProfile.fLoad          = lsp_min(double(sProfile.nLoadTime) * 100.0 / duration, double(meta::ringmod_sc::DSP_LOAD_MAX));
+                    sProfile.nLoadTime      = 0;
+                    sProfile.nLoadSamples   = 0;
+                }
+            }
+
+            if (pDspLoad != NULL)
+                pDspLoad->set_value(sProfile.fLoad);
+        }
+
+        void ringmod_sc::reset_meter_dot(channel_t *c)
+        {
+            c->vDot[MG_IN]          = GAIN_AMP_M_INF_DB;
+            c->vDot[MG_SC]          = GAIN_AMP_M_INF_DB;
+            c->vDot[MG_GAIN]        = FLT_MAX;
+            c->vDot[MG_OUT]         = GAIN_AMP_M_INF_DB;
+        }
+
+        void ringmod_sc::update_meter_values(channel_t *c, const float *values)
+        {
+            // Merge the reduced values into the meters
+            for (size_t j=0; j<MG_TOTAL; ++j)
+            {
+                c->vValues[j]           = (j == MG_GAIN) ?
+                    lsp_min(c->vValues[j], values[j]) :
+                    lsp_max(c->vValues[j], values[j]);
+            }
+        }
+
+        size_t ringmod_sc::update_meter_dot(channel_t *c, const float *values, size_t phase, size_t samples)
+        {
+            // Merge the reduced values into the meters and the current dot
+            update_meter_values(c, values);
+            for (size_t j=0; j<MG_TOTAL; ++j)
+            {
+                c->vDot[j]              = (j == MG_GAIN) ?
+                    lsp_min(c->vDot[j], values[j]) :
+                    lsp_max(c->vDot[j], values[j]);
+            }
+
+            // Emit the dot to the graphs when it is complete
+            phase                  += samples;
+            if (phase < nDotPeriod)
+                return phase;
+
+            for (size_t j=0; j<MG_TOTAL; ++j)
+                if (c->vMetered[j])
+                    c->vGraph[j].process(c->vDot[j]);
+            reset_meter_dot(c);
+
+            return 0;
+        }
+
+        void ringmod_sc::premix_channels(io_buffers_t * io_buf, size_t samples)
+        {
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                io_buffers_t * const io = &io_buf[i];
+
+                // Get pointers to buffers and advance position
+                float * const in_buf    = sPremix.vIn[i];
+                float * const out_buf   = sPremix.vOut[i];
+                float * const sc_buf    = sPremix.vSc[i];
+                float ** const links    = &sPremix.vLink[i * meta::ringmod_sc::LINKS_MAX];
+                const size_t nlinks     = sPremix.vLinks[i];
+
+                io->vOut                = out_buf;
+
+                // Combine shared memory links, the single link is used as is
+                float *link_buf         = NULL;
+                if (nlinks == 1)
+                    link_buf                = links[0];
+                else if (nlinks > 1)
+                {
+                    link_buf                = sPremix.vTmpComb[i];
+                    if (nLinkMode == LINK_MODE_MAX)
+                    {
+                        link_max3(link_buf, links[0], links[1], samples);
+                        for (size_t k=2; k<nlinks; ++k)
+                            link_max2(link_buf, links[k], samples);
+                    }
+                    else
+                    {
+                        dsp::add3(link_buf, links[0], links[1], samples);
+                        for (size_t k=2; k<nlinks; ++k)
+                            dsp::add2(link_buf, links[k], samples);
+                    }
+                }
+
+                // Update pointers
+                sPremix.vIn[i]          = &in_buf[samples];
+                sPremix.vOut[i]         = &out_buf[samples];
+                if (sc_buf != NULL)
+                    sPremix.vSc[i]          = &sc_buf[samples];
+                for (size_t k=0; k<nlinks; ++k)
+                    links[k]                = &links[k][samples];
+
+                // Execute the compiled routes, the missing sidechain is read as silence
+                const premix_route_t *routes    = sPremix.vRoutes[(link_buf != NULL) ? 1 : 0];
+                float * const src[PM_TOTAL]     = { in_buf, (sc_buf != NULL) ? sc_buf : vEmptyBuffer, link_buf };
+                float * const tmp[PM_TOTAL]     = { sPremix.vTmpIn[i], sPremix.vTmpSc[i], sPremix.vTmpLink[i] };
+                float *dst[PM_TOTAL];
+
+                for (size_t j=0; j<PM_TOTAL; ++j)
+                {
+                    const premix_route_t *r = &routes[j];
+                    float * const out       = tmp[j];
+
+                    switch (r->nOp)
+                    {
+                        case PM_OP_MUL:
+                            dsp::mul_k3(out, src[r->vSrc[0]], r->vGain[0], samples);
+                            dst[j]      = out;
+                            break;
+                        case PM_OP_MIX2:
+                            dsp::mix_copy2(out,
+                                src[r->vSrc[0]], src[r->vSrc[1]],
+                                r->vGain[0], r->vGain[1],
+                                samples);
+                            dst[j]      = out;
+                            break;
+                        case PM_OP_MIX3:
+                            dsp::mix_copy3(out,
+                                src[r->vSrc[0]], src[r->vSrc[1]], src[r->vSrc[2]],
+                                r->vGain[0], r->vGain[1], r->vGain[2],
+                                samples);
+                            dst[j]      = out;
+                            break;
+                        case PM_OP_NONE:
+                        default:
+                            dst[j]      = src[j];
+                            break;
+                    }
+                }
+
+                io->vIn                 = dst[PM_IN];
+                io->vScIn               = dst[PM_SC];
+                io->vShmIn              = dst[PM_LINK];
+                io->vLinkIn             = link_buf;
+            }
+        }
+
+        bool ringmod_sc::process_sidechain_frontend(float **sc, io_buffers_t *io, size_t samples)
+        {
+            // The fused front-end covers the stereo full-band path without filters and detectors
+            if ((nChannels != 2) || (nBands > 1) || (bScFilter) || (nDetMode != DET_MODE_PEAK))
+                return false;
+            if (nSource >= sizeof(frontend_kernels) / sizeof(frontend_kernels[0]))
+                return false;
+
+            // Select the source for the specific type of sidechain
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                float *buf          = (nType == SC_TYPE_EXTERNAL) ? io[i].vScIn :
+                                      (nType == SC_TYPE_SHM_LINK) ? io[i].vShmIn :
+                                      io[i].vIn;
+                io[i].vMixSc        = (buf != NULL) ? buf : vEmptyBuffer;
+            }
+
+            // Produce envelopes directly from the raw sidechain signal
+            channel_t *c        = vChannels;
+            float *dst[2]       = { c[0].vBuffer, c[1].vBuffer };
+            float peak[2]       = { c[0].fPeak, c[1].fPeak };
+            uint32_t hold[2]    = { c[0].nHold, c[1].nHold };
+
+            frontend_kernels[nSource](dst, io[0].vMixSc, io[1].vMixSc, sScGain.fValue, sScGain.fDelta, fTauRelease, nHold, peak, hold, samples);
+
+            for (size_t i=0; i<2; ++i)
+            {
+                c[i].fPeak          = peak[i];
+                c[i].nHold          = hold[i];
+                sc[i]               = dst[i];
+            }
+
+            return true;
+        }
+
+        void ringmod_sc::process_sidechain_type(float **sc, io_buffers_t *io, size_t samples)
         {
             // Select the source for the specific type of sidechain
             for (size_t i=0; i<nChannels; ++i)
@@ -544,7 +1863,7 @@ namespace lsp
             }
 
             // Apply sidechain pre-processing depending on selected source (stereo only)
-            if (nChannels <= 1)
+            if (nChannels != 2)
                 return;
 
             switch (nSource)
@@ -601,167 +1920,645 @@ namespace lsp
                 default:
                     break;
             }
-        }
-
-        void ringmod_sc::process_sidechain_envelope(float **sc, size_t samples)
-        {
-            // Pre-process sidechain data for each channel
-            const float sc_gain = fScGain;
+        }
+
+        void ringmod_sc::process_sidechain_subscribe(float **sc, io_buffers_t *io, size_t samples)
+        {
+            // The links contain the envelope computed by another instance, it is read before
+            // the pre-mix stage, so no audio signal is mixed into it. The sidechain gain is
+            // applied to it as it would be applied to the sidechain signal. The envelope is
+            // published after lookahead of the other instance, the own lookahead only delays
+            // the input signal, so both instances should have the same lookahead.
+            const float gain        = sScGain.fValue;
+            const float dgain       = sScGain.fDelta;
+
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+                const float *env    = (io[i].vLinkIn != NULL) ? io[i].vLinkIn : vEmptyBuffer;
+
+                // Keep the sidechain output monitoring the external sidechain signal
+                io[i].vMixSc        = (io[i].vScIn != NULL) ? io[i].vScIn : vEmptyBuffer;
+                dsp::lramp2(c->vBuffer, env, gain, gain + dgain * samples, samples);
+                sc[i]               = c->vBuffer;
+            }
+        }
+
+        void ringmod_sc::publish_envelope(size_t samples)
+        {
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+                float * const dst   = c->vEnvOut;
+                if (dst == NULL)
+                    continue;
+
+                // Publish the maximum of band envelopes in the multiband mode
+                if (nBands > 1)
+                {
+                    dsp::copy(dst, c->vBands[0].vEnv, samples);
+                    for (size_t j=1; j<nBands; ++j)
+                        dsp::pmax2(dst, c->vBands[j].vEnv, samples);
+                }
+                else
+                    dsp::copy(dst, c->vBuffer, samples);
+                c->vEnvOut          = &dst[samples];
+            }
+        }
+
+        void ringmod_sc::process_sidechain_filters(float **sc, size_t samples)
+        {
+            if (!bScFilter)
+                return;
+
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+                c->sScEq.process(c->vBuffer, sc[i], samples);
+                sc[i]               = c->vBuffer;
+            }
+        }
+
+        void ringmod_sc::reset_detectors()
+        {
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c            = &vChannels[i];
+                for (size_t j=0; j<=meta::ringmod_sc::BANDS_MAX; ++j)
+                {
+                    detector_t *d           = (j > 0) ? &c->vBands[j-1].sDetector : &c->sDetector;
+                    if (d->vHistory != NULL)
+                        dsp::fill_zero(d->vHistory, nDetWindow);
+                    d->fSum                 = 0.0f;
+                    d->nHead                = 0;
+                }
+            }
+        }
+
+        void ringmod_sc::process_detector(detector_t *d, float *dst, const float *src, size_t samples)
+        {
+            // Apply sidechain gain and compute the value to average
+            dsp::lramp2(dst, src, sScGain.fValue, sScGain.fValue + sScGain.fDelta * samples, samples);
+            if (nDetMode == DET_MODE_RMS)
+                dsp::sqr1(dst, samples);
+            else
+                dsp::abs1(dst, samples);
+
+            // Update the running sum. It is re-computed from the history each time the
+            // window wraps around, so rounding errors do not accumulate
+            float * const hist      = d->vHistory;
+            const uint32_t window   = nDetWindow;
+            float sum               = d->fSum;
+            uint32_t head           = d->nHead;
+
+            for (size_t offset=0; offset < samples; )
+            {
+                const size_t count      = lsp_min(samples - offset, size_t(window - head));
+                float *v                = &dst[offset];
+                float *h                = &hist[head];
+
+                for (size_t j=0; j<count; ++j)
+                {
+                    const float x           = v[j];
+                    sum                    += x - h[j];
+                    h[j]                    = x;
+                    v[j]                    = sum;
+                }
+
+                offset                 += count;
+                head                   += count;
+                if (head >= window)
+                {
+                    head                    = 0;
+                    sum                     = dsp::h_sum(hist, window);
+                }
+            }
+
+            d->fSum                 = sum;
+            d->nHead                = head;
+
+            // Normalize the sum
+            dsp::mul_k2(dst, 1.0f / window, samples);
+            if (nDetMode == DET_MODE_RMS)
+                dsp::ssqrt1(dst, samples);
+        }
+
+        void ringmod_sc::process_sidechain_envelope(float **sc, size_t samples)
+        {
+            float gain              = sScGain.fValue;
+            float dgain             = sScGain.fDelta;
+
+            // Compute running RMS or mean value, the result is passed to the hold/release stage
+            if (nDetMode != DET_MODE_PEAK)
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    channel_t *c        = &vChannels[i];
+                    process_detector(&c->sDetector, c->vBuffer, sc[i], samples);
+                    sc[i]               = c->vBuffer;
+                }
+                gain                = GAIN_AMP_0_DB;
+                dgain               = 0.0f;
+            }
+
+            // Transform sidechain signal into envelope, process channels in pairs
+            size_t i = 0;
+            for ( ; (i + 2) <= nChannels; i += 2)
+            {
+                channel_t *c        = &vChannels[i];
+                float *dst[2]       = { c[0].vBuffer, c[1].vBuffer };
+                float peak[2]       = { c[0].fPeak, c[1].fPeak };
+                uint32_t hold[2]    = { c[0].nHold, c[1].nHold };
+
+                ringmod_sc_kernels::envelope_x2(dst, &sc[i], gain, dgain, fTauRelease, nHold, peak, hold, samples);
+
+                // Update parameters
+                for (size_t j=0; j<2; ++j)
+                {
+                    c[j].fPeak          = peak[j];
+                    c[j].nHold          = hold[j];
+                    sc[i + j]           = dst[j];
+                }
+            }
+
+            // Process the rest channel
+            for ( ; i < nChannels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+
+                ringmod_sc_kernels::envelope_x1(c->vBuffer, sc[i], gain, dgain, fTauRelease, nHold, &c->fPeak, &c->nHold, samples);
+                sc[i]               = c->vBuffer;
+            }
+        }
+
+        void ringmod_sc::process_window_max(window_max_t *w, float *buf, size_t samples)
+        {
+            float * const value     = w->vValue;
+            uint32_t * const time   = w->vTime;
+            const uint32_t mask     = w->nMask;
+            const uint32_t window   = nDuck;
+            uint32_t head           = w->nHead;
+            uint32_t count          = w->nCount;
+            uint32_t t              = nWndTime;
+
+            for (size_t i=0; i<samples; ++i, ++t)
+            {
+                // Remove all values from the tail that are not greater than the new one
+                const float s           = buf[i];
+                while ((count > 0) && (value[(head + count - 1) & mask] <= s))
+                    --count;
+
+                // Append new value to the tail
+                const uint32_t tail     = (head + count) & mask;
+                value[tail]             = s;
+                time[tail]              = t;
+                ++count;
+
+                // Remove values from the head that went out of the window
+                while ((t - time[head]) > window)
+                {
+                    head                    = (head + 1) & mask;
+                    --count;
+                }
+
+                // The head of the deque always contains the maximum value of the window
+                buf[i]                  = value[head];
+            }
+
+            w->nHead                = head;
+            w->nCount               = count;
+        }
+
+        void ringmod_sc::process_sidechain_delays(float **sc, size_t samples)
+        {
+            const bool window   = (nLkMode == LK_MODE_WINDOW) && (nDuck > 0);
+
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+                float *sc_buf       = sc[i];
+
+                // Now push the buffer contents to the ring buffer
+                c->sEnvDelay.append(sc_buf, samples);
+
+                // Apply lookahead and ducking
+                if ((window) && (c->sWndMax.vValue != NULL))
+                {
+                    // Compute maximum over the whole window
+                    process_window_max(&c->sWndMax, sc_buf, samples);
+                    continue;
+                }
+
+                if (nLookahead > 0)
+                {
+                    c->sEnvDelay.get(vBuffer, nLookahead + samples, samples);
+                    dsp::pmax2(sc_buf, vBuffer, samples);
+                }
+                if (nDuck > nLookahead)
+                {
+                    c->sEnvDelay.get(vBuffer, nDuck + samples, samples);
+                    dsp::pmax2(sc_buf, vBuffer, samples);
+                }
+            }
+
+            nWndTime           += samples;
+        }
+
+        void ringmod_sc::process_sidechain_link(float **sc, size_t samples)
+        {
+            const float slink   = fStereoLink;
+            if (slink <= 0.0f)
+                return;
+
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                // Skip unlinked channels and already processed groups
+                const uint32_t group = vChannels[i].nLinkGroup;
+                if (group == 0)
+                    continue;
+
+                bool processed      = false;
+                for (size_t j=0; j<i; ++j)
+                    if (vChannels[j].nLinkGroup == group)
+                    {
+                        processed       = true;
+                        break;
+                    }
+                if (processed)
+                    continue;
+
+                // Collect channels of the group
+                size_t count        = 0;
+                for (size_t j=i; j<nChannels; ++j)
+                    if (vChannels[j].nLinkGroup == group)
+                        vLinked[count++]    = j;
+                if (count < 2)
+                    continue;
+
+                // For the pair: find the minimum one and try to raise to maximum one
+                // proportionally to the link setup
+                if (count == 2)
+                {
+                    link_pair(sc[vLinked[0]], sc[vLinked[1]], slink, samples);
+                    continue;
+                }
+
+                // For larger groups: raise each channel to the maximum of the group
+                dsp::pmax3(vBuffer, sc[vLinked[0]], sc[vLinked[1]], samples);
+                for (size_t j=2; j<count; ++j)
+                    dsp::pmax2(vBuffer, sc[vLinked[j]], samples);
+                for (size_t j=0; j<count; ++j)
+                    dsp::mix2(sc[vLinked[j]], vBuffer, 1.0f - slink, slink, samples);
+            }
+        }
+
+        void ringmod_sc::split_input(void *object, void *subject, size_t band, const float *data, size_t first, size_t count)
+        {
+            channel_t *c        = static_cast<channel_t *>(object);
+            dsp::copy(&c->vBands[band].vIn[first], data, count);
+        }
+
+        void ringmod_sc::split_sidechain(void *object, void *subject, size_t band, const float *data, size_t first, size_t count)
+        {
+            channel_t *c        = static_cast<channel_t *>(object);
+            dsp::copy(&c->vBands[band].vEnv[first], data, count);
+        }
+
+        void ringmod_sc::process_sidechain_bands(float **sc, size_t samples)
+        {
+            // Split sidechain signal into bands
+            for (size_t i=0; i<nChannels; ++i)
+                vChannels[i].sCrossSc.process(sc[i], samples);
+
+            // Compute running RMS or mean value of each band, the result is passed to the hold/release stage
+            float gain              = sScGain.fValue;
+            float dgain             = sScGain.fDelta;
+            if (nDetMode != DET_MODE_PEAK)
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                    for (size_t j=0; j<nBands; ++j)
+                    {
+                        band_t *b           = &vChannels[i].vBands[j];
+                        process_detector(&b->sDetector, b->vEnv, b->vEnv, samples);
+                    }
+                gain                = GAIN_AMP_0_DB;
+                dgain               = 0.0f;
+            }
 
+            // Transform sidechain signal of each band into envelope, process bands in pairs
             for (size_t i=0; i<nChannels; ++i)
             {
                 channel_t *c        = &vChannels[i];
 
-                // Transform sidechain signal into envelope
-                uint32_t hold       = c->nHold;
-                float peak          = c->fPeak;
-                const float *src    = sc[i];
-                float * const dst   = c->vBuffer;
+                size_t j = 0;
+                for ( ; (j + 2) <= nBands; j += 2)
+                {
+                    band_t *b           = &c->vBands[j];
+                    float *dst[2]       = { b[0].vEnv, b[1].vEnv };
+                    float peak[2]       = { b[0].fPeak, b[1].fPeak };
+                    uint32_t hold[2]    = { b[0].nHold, b[1].nHold };
+
+                    ringmod_sc_kernels::envelope_x2(dst, dst, gain, dgain, fTauRelease, nHold, peak, hold, samples);
+
+                    for (size_t k=0; k<2; ++k)
+                    {
+                        b[k].fPeak          = peak[k];
+                        b[k].nHold          = hold[k];
+                    }
+                }
+
+                for ( ; j < nBands; ++j)
+                {
+                    band_t *b           = &c->vBands[j];
+                    ringmod_sc_kernels::envelope_x1(b->vEnv, b->vEnv, gain, dgain, fTauRelease, nHold, &b->fPeak, &b->nHold, samples);
+                }
+            }
 
-                for (size_t j=0; j<samples; ++j)
+            const bool window       = (nLkMode == LK_MODE_WINDOW) && (nDuck > 0);
+            for (size_t j=0; j<nBands; ++j)
+            {
+                // Apply lookahead and ducking to the envelope of the band
+                for (size_t i=0; i<nChannels; ++i)
                 {
-                    float s             = fabsf(src[j] * sc_gain);  // Rectify input
-                    if (peak > s)
+                    band_t *b           = &vChannels[i].vBands[j];
+                    vBandSc[i]          = b->vEnv;
+
+                    b->sEnvDelay.append(b->vEnv, samples);
+                    if ((window) && (b->sWndMax.vValue != NULL))
                     {
-                        // Current rectified sample is below the peak value
-                        if (hold > 0)
-                        {
-                            s                   = peak;             // Hold peak value
-                            --hold;
-                        }
-                        else
-                        {
-                            s                   = peak + (s - peak) * fTauRelease;
-                            peak                = s;
-                        }
+                        // Compute maximum over the whole window
+                        process_window_max(&b->sWndMax, b->vEnv, samples);
+                        continue;
                     }
-                    else
+
+                    if (nLookahead > 0)
+                    {
+                        b->sEnvDelay.get(vBuffer, nLookahead + samples, samples);
+                        dsp::pmax2(b->vEnv, vBuffer, samples);
+                    }
+                    if (nDuck > nLookahead)
                     {
-                        peak                = s;
-                        hold                = nHold;                // Reset hold counter
+                        b->sEnvDelay.get(vBuffer, nDuck + samples, samples);
+                        dsp::pmax2(b->vEnv, vBuffer, samples);
                     }
-                    dst[j]              = s;
                 }
 
-                // Update parameters
-                c->nHold            = hold;
-                c->fPeak            = peak;
-                sc[i]               = dst;
+                // Link envelopes of the band
+                if (nChannels > 1)
+                    process_sidechain_link(vBandSc, samples);
             }
+
+            nWndTime           += samples;
         }
 
-        void ringmod_sc::process_sidechain_delays(float **sc, size_t samples)
+        void ringmod_sc::apply_sidechain_signal(io_buffers_t *io_buf, size_t samples)
         {
+            // Select the kernel, keep the sidechain output while it fades out
+            const bool out_sc       = lsp_max(sScOutGain.fValue, sScOutGain.fTarget) > GAIN_AMP_M_INF_DB;
+            const apply_func_t func = apply_kernels[
+                (size_t(bInvert) << 3) |
+                (size_t(bOutIn) << 2) |
+                (size_t(out_sc) << 1) |
+                size_t(bActive)];
+
+            const float k[AP_TOTAL]     = { sInGain.fValue, sScOutGain.fValue, sAmount.fValue, sDry.fValue, sWet.fValue };
+            const float dk[AP_TOTAL]    = { sInGain.fDelta, sScOutGain.fDelta, sAmount.fDelta, sDry.fDelta, sWet.fDelta };
+
+            // Process each channel independently
+            size_t phase            = nDotPhase;
             for (size_t i=0; i<nChannels; ++i)
             {
-                channel_t *c        = &vChannels[i];
-                float *sc_buf       = sc[i];
+                channel_t * const c     = &vChannels[i];
+                io_buffers_t * const io = &io_buf[i];
 
-                // Now push the buffer contents to the ring buffer
-                c->sEnvDelay.append(sc_buf, samples);
+                // Apply lookahead delay for input and sidechain signals
+                // c->vBuffer contains envelope signal
+                // vBuffer contains delayed sidechain signal for output
+                c->sInDelay.process(c->vInData, io->vIn, samples);
+                if (out_sc)
+                    c->sScDelay.process(vBuffer, io->vMixSc, samples);
+                else
+                    c->sScDelay.append(io->vMixSc, samples);
 
-                // Apply lookahead and ducking
-                if (nLookahead > 0)
-                {
-                    c->sEnvDelay.get(vBuffer, nLookahead + samples, samples);
-                    dsp::pmax2(sc_buf, vBuffer, samples);
-                }
-                if (nDuck > nLookahead)
+                // Apply input gain, compute gain reduction, mix dry/wet signal,
+                // add sidechain and reduce meter values in one pass. While the graphs
+                // are shown, the chunk is split at the boundaries of meter graph dots,
+                // so each dot is reduced from the kernel output without scanning
+                // buffers again.
+                // c->vInData now contains input signal with applied gain
+                // c->vBuffer now contains gain reduction
+                // vBuffer now contains output signal
+                phase                   = nDotPhase;
+                for (size_t offset=0; offset < samples; )
                 {
-                    c->sEnvDelay.get(vBuffer, nDuck + samples, samples);
-                    dsp::pmax2(sc_buf, vBuffer, samples);
-                }
-            }
-        }
+                    const size_t count      = (bMetering) ? lsp_min(samples - offset, nDotPeriod - phase) : samples;
+                    float kk[AP_TOTAL];
+                    for (size_t j=0; j<AP_TOTAL; ++j)
+                        kk[j]                   = k[j] + dk[j] * offset;
+
+                    float values[MG_TOTAL]  = { GAIN_AMP_M_INF_DB, GAIN_AMP_M_INF_DB, FLT_MAX, GAIN_AMP_M_INF_DB };
+                    func(&vBuffer[offset], &c->vBuffer[offset], &c->vInData[offset], kk, dk, values, count);
+                    if (bMetering)
+                        phase                   = update_meter_dot(c, values, phase, count);
+                    else
+                        update_meter_values(c, values);
 
-        void ringmod_sc::process_sidechain_stereo_link(float **sc, size_t samples)
-        {
-            const float slink   = fStereoLink;
-            if (slink <= 0.0f)
-                return;
+                    offset                 += count;
+                }
 
-            float *lbuf         = sc[0];
-            float *rbuf         = sc[1];
+                // Compensate the latency and reduce aliasing of the modulation
+                if (nOverMode > 0)
+                    process_oversampling(c, k[AP_WET], dk[AP_WET], (bOutIn) && (bActive), samples);
 
-            // For both channels: find the minimum one and try to raise to maximum one
-            // proportionally to the stereo link setup
-            for (size_t i=0; i<samples; ++i)
-            {
-                const float ls      = lbuf[i];
-                const float rs      = rbuf[i];
-                if (ls < rs)
-                    lbuf[i]             = ls + (rs - ls) * slink;
-                else
-                    rbuf[i]             = rs + (ls - rs) * slink;
+                // Apply bypass
+                c->sBypass.process(io->vOut, c->vInData, vBuffer, samples);
             }
+
+            nDotPhase               = phase;
         }
 
-        void ringmod_sc::apply_sidechain_signal(io_buffers_t *io_buf, size_t samples)
+        void ringmod_sc::apply_sidechain_bands(io_buffers_t *io_buf, size_t samples)
         {
+            // Keep the sidechain output while it fades out
+            const bool out_sc       = lsp_max(sScOutGain.fValue, sScOutGain.fTarget) > GAIN_AMP_M_INF_DB;
+            const band_gain_func_t gain_func = (bInvert) ? band_gain_kernel<true> : band_gain_kernel<false>;
+            const band_mix_func_t mix_func = band_mix_kernels[
+                (size_t(bOutIn) << 2) |
+                (size_t(out_sc) << 1) |
+                size_t(bActive)];
+            const float k[AP_TOTAL]     = { sInGain.fValue, sScOutGain.fValue, sAmount.fValue, sDry.fValue, sWet.fValue };
+            const float dk[AP_TOTAL]    = { sInGain.fDelta, sScOutGain.fDelta, sAmount.fDelta, sDry.fDelta, sWet.fDelta };
+            float * const sum       = vBandSum;
+            float * const env       = vBandEnv;
+
             // Process each channel independently
+            size_t phase            = nDotPhase;
             for (size_t i=0; i<nChannels; ++i)
             {
                 channel_t * const c     = &vChannels[i];
                 io_buffers_t * const io = &io_buf[i];
 
-                // Compute the gain reduction
-                // c->vBuffer contains envelope signal
-                // vBuffer should contain gain reduction
-                if (bInvert)
-                    dsp::mul_k3(vBuffer, c->vBuffer, fAmount, samples);
+                // Apply lookahead delay for input and sidechain signals
+                // vBuffer contains delayed sidechain signal for output
+                c->sInDelay.process(c->vInData, io->vIn, samples);
+                if (out_sc)
+                    c->sScDelay.process(vBuffer, io->vMixSc, samples);
                 else
-                {
-                    for (size_t j=0; j<samples; ++j)
-                        vBuffer[j]          = lsp_max(0.0f, GAIN_AMP_0_DB - c->vBuffer[j] * fAmount);
-                }
-
-                c->vGraph[MG_GAIN].process(vBuffer, samples);
-                c->vValues[MG_GAIN] = lsp_min(c->vValues[MG_GAIN], dsp::abs_min(vBuffer, samples));
-
-                // Apply lookahead delay for input signal
-                c->sInDelay.process(c->vInData, io->vIn, fInGain, samples);
-                c->vGraph[MG_IN].process(c->vInData, samples);
-                c->vValues[MG_IN]   = lsp_max(c->vValues[MG_IN], dsp::abs_max(c->vInData, samples));
-                c->vGraph[MG_SC].process(c->vBuffer, samples);
-                c->vValues[MG_SC]   = lsp_max(c->vValues[MG_SC], dsp::abs_max(c->vBuffer, samples));
+                    c->sScDelay.append(io->vMixSc, samples);
 
-                // Apply gain reduction and mix dry/wet signal
-                if (bOutIn)
+                // Apply input gain and split the input signal into bands
+                dsp::lramp1(c->vInData, sInGain.fValue, sInGain.fValue + sInGain.fDelta * samples, samples);
+                c->sCrossIn.process(c->vInData, samples);
+
+                // Compute gain reduction of each band and sum the modulated bands
+                // env contains the maximum envelope of bands
+                // c->vBuffer contains the minimum gain reduction of bands
+                dsp::fill_zero(sum, samples);
+                dsp::fill_zero(env, samples);
+                dsp::fill_one(c->vBuffer, samples);
+                for (size_t j=0; j<nBands; ++j)
                 {
-                    if (bActive)
-                    {
-                        dsp::mul2(vBuffer, c->vInData, samples); // vBuffer now contains gain-reduced input signal
-                        dsp::mix2(vBuffer, c->vInData, fWet, fDry, samples);
-                    }
-                    else
-                        dsp::copy(vBuffer, c->vInData, samples);
+                    band_t *b               = &c->vBands[j];
+
+                    dsp::pmax2(env, b->vEnv, samples);
+                    gain_func(b->vEnv, sAmount.fValue, sAmount.fDelta, samples);
+                    dsp::pmin2(c->vBuffer, b->vEnv, samples);
+                    dsp::fmadd3(sum, b->vIn, b->vEnv, samples);
                 }
 
-                // Add sidechain signal and process graph for output
-                const float sc_out_gain = (bOutSc) ? fScGain * fOutGain : GAIN_AMP_M_INF_DB;
-                if (sc_out_gain > GAIN_AMP_M_INF_DB)
+                // Mix the output signal and reduce meter values in one pass, the chunk
+                // is split at the boundaries of meter graph dots while the graphs are shown
+                // vBuffer now contains output signal
+                phase                   = nDotPhase;
+                for (size_t offset=0; offset < samples; )
                 {
-                    if (bOutIn)
-                    {
-                        c->sScDelay.process(c->vBuffer, io->vMixSc, sc_out_gain, samples);
-                        dsp::add2(vBuffer, c->vBuffer, samples);
-                    }
+                    const size_t count      = (bMetering) ? lsp_min(samples - offset, nDotPeriod - phase) : samples;
+                    float kk[AP_TOTAL];
+                    for (size_t j=0; j<AP_TOTAL; ++j)
+                        kk[j]                   = k[j] + dk[j] * offset;
+
+                    float values[MG_TOTAL]  = { GAIN_AMP_M_INF_DB, GAIN_AMP_M_INF_DB, FLT_MAX, GAIN_AMP_M_INF_DB };
+                    mix_func(&vBuffer[offset], &sum[offset], &c->vInData[offset], &env[offset], &c->vBuffer[offset],
+                        kk, dk, values, count);
+                    if (bMetering)
+                        phase                   = update_meter_dot(c, values, phase, count);
                     else
-                        c->sScDelay.process(vBuffer, io->vMixSc, sc_out_gain, samples);
+                        update_meter_values(c, values);
+                    offset                 += count;
                 }
-                else
+
+                // The bands are not oversampled, only keep the latency reported for the oversampling
+                if (nOverMode > 0)
                 {
-                    c->sScDelay.append(io->vMixSc, samples);
-                    if (!bOutIn)
-                        dsp::fill_zero(vBuffer, samples);
+                    c->sOutDelay.process(vBuffer, vBuffer, samples);
+                    c->sDryDelay.process(c->vInData, c->vInData, samples);
                 }
 
-                c->vGraph[MG_OUT].process(vBuffer, samples);
-                c->vValues[MG_OUT]  = lsp_max(c->vValues[MG_OUT], dsp::abs_max(vBuffer, samples));
-
                 // Apply bypass
                 c->sBypass.process(io->vOut, c->vInData, vBuffer, samples);
             }
+
+            nDotPhase               = phase;
+        }
+
+        void ringmod_sc::prime_oversampling(channel_t *c)
+        {
+            // Pass the recent history through the oversamplers to bring
+            // the state of their filters up to date, drop the output
+            float * const a         = vOverBuf[0];
+            float * const b         = vOverBuf[1];
+            const float *hist_in    = c->vOverHist;
+            const float *hist_gain  = &c->vOverHist[OVERSAMPLING_PRIME];
+
+            c->sOverIn.upsample(a, hist_in, OVERSAMPLING_PRIME);
+            c->sOverGain.upsample(b, hist_gain, OVERSAMPLING_PRIME);
+            dsp::mul2(a, b, OVERSAMPLING_PRIME * nOverTimes);
+            c->sOverIn.downsample(b, a, OVERSAMPLING_PRIME);
+        }
+
+        void ringmod_sc::process_oversampling(channel_t *c, float wet, float dwet, bool modulated, size_t samples)
+        {
+            // c->vInData contains input signal
+            // c->vBuffer contains gain reduction
+            // vBuffer contains output signal
+            float * const prod      = vOverProd;
+            float * const a         = vOverBuf[0];
+            float * const b         = vOverBuf[1];
+            float * const hist_in   = c->vOverHist;
+            float * const hist_gain = &c->vOverHist[OVERSAMPLING_PRIME];
+
+            // The correction is added to the output after the output delay, so the wet gain
+            // is applied to the gain reduction before the oversampler and the product delay,
+            // the same way it is applied to the output before the output delay.
+            // prod contains the gain reduction multiplied by the wet gain, zero if the output
+            // does not contain the modulated signal
+            if (modulated)
+                dsp::lramp2(prod, c->vBuffer, wet, wet + dwet * samples, samples);
+            else
+                dsp::fill_zero(prod, samples);
+
+            // Keep the oversampling active while the gain changes and until the change has
+            // left the delayed output. The last gain of the previous chunk is taken into account,
+            // so switching the modulation on and off is also considered to be a change
+            float gmin, gmax;
+            const float glast       = hist_gain[OVERSAMPLING_PRIME - 1];
+            dsp::minmax(prod, samples, &gmin, &gmax);
+            if ((lsp_max(gmax, glast) - lsp_min(gmin, glast)) > OVERSAMPLING_GAIN_DELTA)
+                c->nOverHold            = OVERSAMPLING_PRIME + nOverLatency;
+            else
+                c->nOverHold           -= lsp_min(size_t(c->nOverHold), samples);
+
+            // The fade-in starts before the change of the gain reaches the delayed output,
+            // the fade-out starts after the change has left it
+            const float fade_start  = c->fOverFade;
+            const float fade_end    = (c->nOverHold > 0) ? 1.0f : 0.0f;
+            const bool oversample   = (fade_start > 0.0f) || (fade_end > 0.0f);
+
+            if (oversample)
+            {
+                if (fade_start <= 0.0f)
+                    prime_oversampling(c);
+
+                // Modulate the oversampled signal
+                c->sOverIn.upsample(a, c->vInData, samples);
+                c->sOverGain.upsample(b, prod, samples);
+                dsp::mul2(a, b, samples * nOverTimes);
+                c->sOverIn.downsample(b, a, samples);
+            }
+
+            // Update the history of the input signal and the gain
+            if (samples >= OVERSAMPLING_PRIME)
+            {
+                dsp::copy(hist_in, &c->vInData[samples - OVERSAMPLING_PRIME], OVERSAMPLING_PRIME);
+                dsp::copy(hist_gain, &prod[samples - OVERSAMPLING_PRIME], OVERSAMPLING_PRIME);
+            }
+            else
+            {
+                const size_t keep       = OVERSAMPLING_PRIME - samples;
+                dsp::move(hist_in, &hist_in[samples], keep);
+                dsp::move(hist_gain, &hist_gain[samples], keep);
+                dsp::copy(&hist_in[keep], c->vInData, samples);
+                dsp::copy(&hist_gain[keep], prod, samples);
+            }
+
+            // The modulated signal at original sample rate, delayed by the oversampling latency
+            dsp::mul2(prod, c->vInData, samples);
+            c->sProdDelay.process(prod, prod, samples);
+
+            // Compute the correction to the delayed modulated signal, cross-fade it on state change
+            if (oversample)
+            {
+                dsp::sub2(b, prod, samples);
+                dsp::lramp1(b, fade_start, fade_end, samples);
+            }
+
+            // Align output and dry signals with the oversampled signal, apply correction
+            c->sOutDelay.process(vBuffer, vBuffer, samples);
+            c->sDryDelay.process(c->vInData, c->vInData, samples);
+            if (oversample)
+                dsp::add2(vBuffer, b, samples);
+
+            c->fOverFade            = fade_end;
         }
 
         void ringmod_sc::output_meters()
@@ -774,8 +2571,12 @@ namespace lsp
             }
         }
 
-        void ringmod_sc::output_meshes()
+        void ringmod_sc::output_meshes(bool refresh)
         {
+            // Publish the mesh not often than the UI is able to display it
+            if ((!refresh) && (!bClear) && (!bUISync))
+                return;
+
             plug::mesh_t *mesh = (pGraphMesh != NULL) ? pGraphMesh->buffer<plug::mesh_t>() : NULL;
             if ((mesh == NULL) || (!mesh->isEmpty()))
                 return;
@@ -827,8 +2628,10 @@ namespace lsp
 
         void ringmod_sc::process(size_t samples)
         {
-            io_buffers_t io_buf[2];
-            float *sc[2];
+            const uint64_t start    = (bProfile) ? profile_time() : 0;
+
+            // Apply the settings snapshot computed in background
+            sync_settings();
 
             // Prepare audio channels
             for (size_t i=0; i<nChannels; ++i)
@@ -839,11 +2642,21 @@ namespace lsp
                 sPremix.vIn[i]      = c->pIn->buffer<float>();
                 sPremix.vOut[i]     = c->pOut->buffer<float>();
                 sPremix.vSc[i]      = c->pScIn->buffer<float>();
-                sPremix.vLink[i]    = NULL;
 
-                core::AudioBuffer *buf = (c->pShmIn != NULL) ? c->pShmIn->buffer<core::AudioBuffer>() : NULL;
-                if ((buf != NULL) && (buf->active()))
-                    sPremix.vLink[i]    = buf->buffer();
+                // Collect active shared memory links
+                float ** const links = &sPremix.vLink[i * meta::ringmod_sc::LINKS_MAX];
+                size_t nlinks       = 0;
+                for (size_t k=0; k<meta::ringmod_sc::LINKS_MAX; ++k)
+                {
+                    core::AudioBuffer *buf = (c->vShmIn[k] != NULL) ? c->vShmIn[k]->buffer<core::AudioBuffer>() : NULL;
+                    if ((buf != NULL) && (buf->active()))
+                        links[nlinks++]     = buf->buffer();
+                }
+                sPremix.vLinks[i]   = nlinks;
+
+                // Get the envelope send buffer
+                core::AudioBuffer *env = (c->pEnvOut != NULL) ? c->pEnvOut->buffer<core::AudioBuffer>() : NULL;
+                c->vEnvOut          = ((env != NULL) && (env->active())) ? env->buffer() : NULL;
 
                 // Initialize meters
                 c->vValues[MG_IN]   = GAIN_AMP_M_INF_DB;
@@ -852,31 +2665,256 @@ namespace lsp
                 c->vValues[MG_OUT]  = GAIN_AMP_M_INF_DB;
             }
 
-            // Process data
+            // Ramp the parameters linearly over the whole host block: automation is applied
+            // at the block rate, events within the block are not sample-accurate
+            start_ramps(samples);
+            update_metering();
+
+            // Check whether the whole processing chain can be skipped, the inputs
+            // are scanned only when the envelopes have already decayed to silence
+            const bool quiet        = envelopes_silent() && inputs_silent(samples);
+            if ((bIdle) && (quiet))
+            {
+                const uint64_t time     = (bProfile) ? profile_time() : 0;
+                process_idle(samples);
+                if (bProfile)
+                    profile_stage(PS_IDLE, time);
+            }
+            else
+            {
+                bIdle                   = false;
+                process_chain(samples);
+                update_idle_state(quiet, samples);
+            }
+
+            complete_ramps();
+
+            // Output meters and meshes, limit the UI update rate
+            nRefreshCounter        += samples;
+            const bool refresh      = nRefreshCounter >= nRefreshPeriod;
+            if (refresh)
+            {
+                nRefreshCounter         = 0;
+                nIDisplayAge            = lsp_min(nIDisplayAge + 1, IDISPLAY_TIMEOUT);
+            }
+
+            const uint64_t time     = (bProfile) ? profile_time() : 0;
+            output_meters();
+            output_meshes(refresh);
+            if (bProfile)
+                profile_stage(PS_OUTPUT, time);
+            update_profile(start, samples, refresh);
+
+            // Request for redraw
+            if ((refresh) && (pWrapper != NULL))
+                pWrapper->query_display_draw();
+        }
+
+        void ringmod_sc::process_chain(size_t samples)
+        {
             for (size_t offset = 0; offset < samples;)
             {
-                const size_t to_process     = lsp_min(samples - offset, BUFFER_SIZE);
+                const size_t to_process     = lsp_min(samples - offset, nBufSize);
+                uint64_t time               = (bProfile) ? profile_time() : 0;
 
                 // Do processing
-                premix_channels(io_buf, to_process);
-                process_sidechain_type(sc, io_buf, to_process);
-                process_sidechain_envelope(sc, to_process);
-                process_sidechain_delays(sc, to_process);
-                if (nChannels > 1)
-                    process_sidechain_stereo_link(sc, to_process);
-                apply_sidechain_signal(io_buf, to_process);
+                premix_channels(vIOBuffers, to_process);
+                if (bProfile)
+                    time                        = profile_stage(PS_PREMIX, time);
+
+                if (nType == SC_TYPE_ENVELOPE)
+                    process_sidechain_subscribe(vSc, vIOBuffers, to_process);
+                else if (process_sidechain_frontend(vSc, vIOBuffers, to_process))
+                {
+                    process_sidechain_delays(vSc, to_process);
+                    process_sidechain_link(vSc, to_process);
+                }
+                else if (nBands > 1)
+                {
+                    process_sidechain_type(vSc, vIOBuffers, to_process);
+                    process_sidechain_filters(vSc, to_process);
+                    process_sidechain_bands(vSc, to_process);
+                }
+                else
+                {
+                    process_sidechain_type(vSc, vIOBuffers, to_process);
+                    process_sidechain_filters(vSc, to_process);
+                    process_sidechain_envelope(vSc, to_process);
+                    process_sidechain_delays(vSc, to_process);
+                    if (nChannels > 1)
+                        process_sidechain_link(vSc, to_process);
+                }
+                publish_envelope(to_process);
+                if (bProfile)
+                    time                        = profile_stage(PS_SIDECHAIN, time);
+
+                if (nBands > 1)
+                    apply_sidechain_bands(vIOBuffers, to_process);
+                else
+                    apply_sidechain_signal(vIOBuffers, to_process);
+                if (bProfile)
+                    profile_stage(PS_APPLY, time);
+
+                advance_ramps(to_process);
 
                 // Update pointer
                 offset             += to_process;
             }
+        }
 
-            // Output meters and meshes
-            output_meters();
-            output_meshes();
+        bool ringmod_sc::inputs_silent(size_t samples) const
+        {
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                if (dsp::abs_max(sPremix.vIn[i], samples) > SILENCE_THRESHOLD)
+                    return false;
+                if ((sPremix.vSc[i] != NULL) && (dsp::abs_max(sPremix.vSc[i], samples) > SILENCE_THRESHOLD))
+                    return false;
 
-            // Request for redraw
-            if (pWrapper != NULL)
-                pWrapper->query_display_draw();
+                float * const *links    = &sPremix.vLink[i * meta::ringmod_sc::LINKS_MAX];
+                for (size_t k=0; k<sPremix.vLinks[i]; ++k)
+                {
+                    if (dsp::abs_max(links[k], samples) > SILENCE_THRESHOLD)
+                        return false;
+                }
+            }
+
+            return true;
+        }
+
+        bool ringmod_sc::envelopes_silent() const
+        {
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                const channel_t *c      = &vChannels[i];
+                if (c->fPeak > SILENCE_THRESHOLD)
+                    return false;
+                for (size_t j=0; j<nBands; ++j)
+                    if (c->vBands[j].fPeak > SILENCE_THRESHOLD)
+                        return false;
+            }
+
+            return true;
+        }
+
+        void ringmod_sc::reset_bands()
+        {
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c            = &vChannels[i];
+                for (size_t j=0; j<meta::ringmod_sc::BANDS_MAX; ++j)
+                {
+                    band_t *b               = &c->vBands[j];
+                    b->sEnvDelay.clear();
+                    b->sWndMax.nHead        = 0;
+                    b->sWndMax.nCount       = 0;
+                    b->fPeak                = 0.0f;
+                    b->nHold                = 0;
+                }
+            }
+        }
+
+        void ringmod_sc::update_idle_state(bool quiet, size_t samples)
+        {
+            // The block is counted as idle only if it started and ended in silence
+            if ((!quiet) || (!envelopes_silent()))
+            {
+                nIdleSamples            = 0;
+                return;
+            }
+
+            // Wait until everything the delay lines, detectors and oversamplers may still read
+            // has been silent, and until the band crossovers have drained
+            const size_t det_window = (nDetMode != DET_MODE_PEAK) ? nDetWindow : 0;
+            const size_t drain      = (nBands > 1) ? dspu::seconds_to_samples(fSampleRate, CROSSOVER_DRAIN_TIME) : 0;
+            nIdleSamples            = lsp_min(nIdleSamples + samples, size_t(UINT32_MAX));
+            if (nIdleSamples < nDuck + det_window + nOverLatency + drain + nBufSize)
+                return;
+
+            // Enter the idle state: the sidechain delay lines contain only silence now.
+            // The input and dry delay lines keep running in the idle state for the bypass
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c            = &vChannels[i];
+
+                c->sScDelay.clear();
+                c->sEnvDelay.clear();
+                c->sScEq.reset();
+                c->sWndMax.nHead        = 0;
+                c->sWndMax.nCount       = 0;
+                c->fPeak                = 0.0f;
+                c->nHold                = 0;
+
+                c->sOutDelay.clear();
+                c->sProdDelay.clear();
+                c->fOverFade            = 0.0f;
+                c->nOverHold            = 0;
+                dsp::fill_zero(c->vOverHist, OVERSAMPLING_PRIME * 2);
+            }
+
+            reset_detectors();
+            reset_bands();
+            bIdle                   = true;
+        }
+
+        void ringmod_sc::process_idle(size_t samples)
+        {
+            // With silent sidechain the gain reduction is zero in the inverse mode and unity otherwise
+            const float gain                = (bInvert) ? GAIN_AMP_M_INF_DB : GAIN_AMP_0_DB;
+            const float silence[MG_TOTAL]   = { GAIN_AMP_M_INF_DB, GAIN_AMP_M_INF_DB, gain, GAIN_AMP_M_INF_DB };
+
+            for (size_t offset = 0; offset < samples;)
+            {
+                const size_t to_process     = lsp_min(samples - offset, nBufSize);
+                const float in_gain         = sInGain.fValue + sInGain.fDelta * offset;
+
+                size_t phase                = nDotPhase;
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    channel_t *c            = &vChannels[i];
+                    float * const in        = sPremix.vIn[i];
+                    float * const out       = sPremix.vOut[i];
+
+                    // Keep the time axis of graphs moving
+                    phase                   = nDotPhase;
+                    if (bMetering)
+                    {
+                        for (size_t n=0; n < to_process; )
+                        {
+                            const size_t count      = lsp_min(to_process - n, nDotPeriod - phase);
+                            phase                   = update_meter_dot(c, silence, phase, count);
+                            n                      += count;
+                        }
+                    }
+                    else
+                        update_meter_values(c, silence);
+
+                    // Pass the input signal through the delay lines in the same way as the processing
+                    // chain does, so the bypass keeps the signal below the silence threshold
+                    c->sInDelay.process(c->vInData, in, to_process);
+                    dsp::lramp1(c->vInData, in_gain, in_gain + sInGain.fDelta * to_process, to_process);
+                    if (nOverMode > 0)
+                        c->sDryDelay.process(c->vInData, c->vInData, to_process);
+
+                    // Keep the bypass switch state consistent
+                    c->sBypass.process(out, c->vInData, vEmptyBuffer, to_process);
+                    sPremix.vIn[i]          = &in[to_process];
+                    sPremix.vOut[i]         = &out[to_process];
+
+                    // Publish silent envelope
+                    if (c->vEnvOut != NULL)
+                    {
+                        dsp::fill_zero(c->vEnvOut, to_process);
+                        c->vEnvOut              = &c->vEnvOut[to_process];
+                    }
+                }
+
+                if (bMetering)
+                    nDotPhase               = phase;
+                offset             += to_process;
+            }
+
+            nWndTime           += samples;
         }
 
         bool ringmod_sc::inline_display(plug::ICanvas *cv, size_t width, size_t height)
@@ -890,6 +2928,9 @@ namespace lsp
             constexpr float x_zero  = 0.0f;
             constexpr float x_step  = 1.0f;
 
+            // Keep the graphs running while the inline display is shown
+            nIDisplayAge    = 0;
+
             // Check proportions
             if (height > (M_RGOLD_RATIO * width))
                 height  = M_RGOLD_RATIO * width;
@@ -929,8 +2970,10 @@ namespace lsp
                 cv->line(0, ay, width, ay);
             }
 
-            // Allocate buffer: t, f(t), x, y
-            pIDisplay           = core::IDBuffer::reuse(pIDisplay, 4, width);
+            // Allocate buffer: x, f(x), y. Each column is drawn as a pair of points:
+            // the minimum and the maximum of the graph values covered by the column.
+            const size_t points = width * 2;
+            pIDisplay           = core::IDBuffer::reuse(pIDisplay, 3, points);
             core::IDBuffer *b   = pIDisplay;
             if (b == NULL)
                 return false;
@@ -940,13 +2983,15 @@ namespace lsp
                     CV_LEFT_CHANNEL_IN, CV_LEFT_CHANNEL, CV_BRIGHT_GREEN, CV_BRIGHT_BLUE,
                     CV_RIGHT_CHANNEL_IN, CV_RIGHT_CHANNEL, CV_BRIGHT_GREEN, CV_BRIGHT_BLUE
                    };
-            uint32_t *cols      = (nChannels > 1) ? &c_colors[MG_TOTAL] : c_colors;
-            float r             = meta::ringmod_sc::TIME_MESH_SIZE/float(width);
+            const size_t mesh_size  = meta::ringmod_sc::TIME_MESH_SIZE;
+            const float r       = mesh_size/float(width);
 
+            // Compute horizontal coordinates once for all graphs
             for (size_t j=0; j<width; ++j)
             {
-                size_t k        = r*j;
-                b->v[0][j]      = vTime[k];
+                const float x   = width + dx * vTime[size_t(r*j)];
+                b->v[0][j*2]    = x;
+                b->v[0][j*2+1]  = x;
             }
 
             cv->set_line_width(2.0f);
@@ -958,32 +3003,100 @@ namespace lsp
                     if (!c->vVisible[j])
                         continue;
 
-                    // Initialize values
-                    c->vGraph[j].read(vIDisplay, meta::ringmod_sc::TIME_MESH_SIZE);
+                    // Mono uses middle channel colors, multichannel ones alternate left and right
+                    const uint32_t *cols = (nChannels > 1) ? &c_colors[((i & 1) + 1) * MG_TOTAL] : c_colors;
+
+                    // Decimate values, keep both minimum and maximum for each column
+                    c->vGraph[j].read(vIDisplay, mesh_size);
                     for (size_t k=0; k<width; ++k)
-                        b->v[1][k]      = vIDisplay[size_t(r*k)];
+                    {
+                        const size_t first  = lsp_min(size_t(r*k), mesh_size - 1);
+                        const size_t last   = lsp_limit(size_t(r*(k+1)), first + 1, mesh_size);
+                        float vmin          = vIDisplay[first];
+                        float vmax          = vmin;
+                        for (size_t n=first+1; n<last; ++n)
+                        {
+                            vmin                = lsp_min(vmin, vIDisplay[n]);
+                            vmax                = lsp_max(vmax, vIDisplay[n]);
+                        }
+                        b->v[1][k*2]        = vmin;
+                        b->v[1][k*2+1]      = vmax;
+                    }
 
-                    // Initialize coords
-                    dsp::fill(b->v[2], width, width);
-                    dsp::fill(b->v[3], height, width);
-                    dsp::fmadd_k3(b->v[2], b->v[0], dx, width);
-                    dsp::axis_apply_log1(b->v[3], b->v[1], zy, dy, width);
+                    // Initialize vertical coords
+                    dsp::fill(b->v[2], height, points);
+                    dsp::axis_apply_log1(b->v[2], b->v[1], zy, dy, points);
 
                     // Draw channel
-                    cv->set_color_rgb((bypassing) ? CV_SILVER : cols[j + i*MG_TOTAL]);
-                    cv->draw_lines(b->v[2], b->v[3], width);
+                    cv->set_color_rgb((bypassing) ? CV_SILVER : cols[j]);
+                    cv->draw_lines(b->v[0], b->v[2], points);
                 }
             }
 
             return true;
         }
 
+        void ringmod_sc::dump_ramp(dspu::IStateDumper *v, const char *name, const ramp_t *r)
+        {
+            v->begin_object(name, r, sizeof(ramp_t));
+            {
+                v->write("fValue", r->fValue);
+                v->write("fTarget", r->fTarget);
+                v->write("fDelta", r->fDelta);
+            }
+            v->end_object();
+        }
+
+        void ringmod_sc::dump_request(dspu::IStateDumper *v, const char *name, const settings_request_t *r)
+        {
+            v->begin_object(name, r, sizeof(settings_request_t));
+            {
+                v->write("fSampleRate", r->fSampleRate);
+                v->write("fHold", r->fHold);
+                v->write("fRelease", r->fRelease);
+                v->write("fLookahead", r->fLookahead);
+                v->write("fDuck", r->fDuck);
+                v->write("fDetWindow", r->fDetWindow);
+                v->write("fAmount", r->fAmount);
+                v->write("nType", r->nType);
+                v->write("nHpfMode", r->nHpfMode);
+                v->write("nLpfMode", r->nLpfMode);
+                v->write("fHpfFreq", r->fHpfFreq);
+                v->write("fLpfFreq", r->fLpfFreq);
+                v->write("nBands", r->nBands);
+                v->writev("vSplit", r->vSplit, meta::ringmod_sc::BANDS_MAX - 1);
+                v->write("nOverMode", r->nOverMode);
+            }
+            v->end_object();
+        }
+
+        void ringmod_sc::dump_settings(dspu::IStateDumper *v, const char *name, const settings_t *s)
+        {
+            v->begin_object(name, s, sizeof(settings_t));
+            {
+                v->write("fTauRelease", s->fTauRelease);
+                v->write("fAmount", s->fAmount);
+                v->write("nHold", s->nHold);
+                v->write("nLookahead", s->nLookahead);
+                v->write("nDuck", s->nDuck);
+                v->write("nDetWindow", s->nDetWindow);
+                v->write("nType", s->nType);
+                v->write("nBands", s->nBands);
+                v->write("nOverMode", s->nOverMode);
+                v->write("bScFilter", s->bScFilter);
+                v->writev("vSplit", s->vSplit, meta::ringmod_sc::BANDS_MAX - 1);
+            }
+            v->end_object();
+        }
+
         void ringmod_sc::dump(dspu::IStateDumper *v) const
         {
             plug::Module::dump(v);
 
             // It is very useful to dump plugin state for debug purposes
             v->write("nChannels", nChannels);
+            v->write("bShmLink", bShmLink);
+            v->write("nBufSize", nBufSize);
             v->begin_array("vChannels", vChannels, nChannels);
             for (size_t i=0; i<nChannels; ++i)
             {
@@ -994,12 +3107,74 @@ namespace lsp
                     v->write_object("sBypass", &c->sBypass);
                     v->write_object("sInDelay", &c->sInDelay);
                     v->write_object("sScDelay", &c->sScDelay);
+                    v->write_object("sScEq", &c->sScEq);
                     v->write_object("sEnvDelay", &c->sEnvDelay);
                     v->write_object_array("vGraph", c->vGraph, MG_TOTAL);
+                    v->begin_object("sWndMax", &c->sWndMax, sizeof(window_max_t));
+                    {
+                        v->write("vValue", c->sWndMax.vValue);
+                        v->write("vTime", c->sWndMax.vTime);
+                        v->write("nHead", c->sWndMax.nHead);
+                        v->write("nCount", c->sWndMax.nCount);
+                        v->write("nMask", c->sWndMax.nMask);
+                    }
+                    v->end_object();
+                    v->begin_object("sDetector", &c->sDetector, sizeof(detector_t));
+                    {
+                        v->write("vHistory", c->sDetector.vHistory);
+                        v->write("fSum", c->sDetector.fSum);
+                        v->write("nHead", c->sDetector.nHead);
+                    }
+                    v->end_object();
 
                     v->write("fPeak", c->fPeak);
                     v->write("nHold", c->nHold);
+                    v->write("nLinkGroup", c->nLinkGroup);
                     v->writev("vVisible", c->vVisible, MG_TOTAL);
+                    v->writev("vMetered", c->vMetered, MG_TOTAL);
+                    v->writev("vDot", c->vDot, MG_TOTAL);
+                    v->write_object("sOverIn", &c->sOverIn);
+                    v->write_object("sOverGain", &c->sOverGain);
+                    v->write_object("sOutDelay", &c->sOutDelay);
+                    v->write_object("sDryDelay", &c->sDryDelay);
+                    v->write_object("sProdDelay", &c->sProdDelay);
+                    v->write("vOverHist", c->vOverHist);
+                    v->write("vEnvOut", c->vEnvOut);
+                    v->write("fOverFade", c->fOverFade);
+                    v->write("nOverHold", c->nOverHold);
+                    v->write_object("sCrossIn", &c->sCrossIn);
+                    v->write_object("sCrossSc", &c->sCrossSc);
+                    v->begin_array("vBands", c->vBands, meta::ringmod_sc::BANDS_MAX);
+                    for (size_t j=0; j<meta::ringmod_sc::BANDS_MAX; ++j)
+                    {
+                        const band_t *b         = &c->vBands[j];
+                        v->begin_object(b, sizeof(band_t));
+                        {
+                            v->write_object("sEnvDelay", &b->sEnvDelay);
+                            v->begin_object("sWndMax", &b->sWndMax, sizeof(window_max_t));
+                            {
+                                v->write("vValue", b->sWndMax.vValue);
+                                v->write("vTime", b->sWndMax.vTime);
+                                v->write("nHead", b->sWndMax.nHead);
+                                v->write("nCount", b->sWndMax.nCount);
+                                v->write("nMask", b->sWndMax.nMask);
+                            }
+                            v->end_object();
+                            v->begin_object("sDetector", &b->sDetector, sizeof(detector_t));
+                            {
+                                v->write("vHistory", b->sDetector.vHistory);
+                                v->write("fSum", b->sDetector.fSum);
+                                v->write("nHead", b->sDetector.nHead);
+                            }
+                            v->end_object();
+                            v->write("fPeak", b->fPeak);
+                            v->write("nHold", b->nHold);
+                            v->write("vIn", b->vIn);
+                            v->write("vEnv", b->vEnv);
+                        }
+                        v->end_object();
+                    }
+                    v->end_array();
                     v->writev("vValues", c->vValues, MG_TOTAL);
                     v->write("vInData", c->vInData);
                     v->write("vBuffer", c->vBuffer);
@@ -1007,7 +3182,9 @@ namespace lsp
                     v->write("pIn", c->pIn);
                     v->write("pOut", c->pOut);
                     v->write("pScIn", c->pScIn);
-                    v->write("pShmIn", c->pShmIn);
+                    v->writev("vShmIn", c->vShmIn, meta::ringmod_sc::LINKS_MAX);
+                    v->write("pEnvOut", c->pEnvOut);
+                    v->write("pLinkGroup", c->pLinkGroup);
                     v->writev("vVisibility", c->vVisibility, MG_TOTAL);
                     v->writev("vMeters", c->vMeters, MG_TOTAL);
                 }
@@ -1015,10 +3192,15 @@ namespace lsp
             }
             v->end_array();
 
-
+            v->write("vIOBuffers", vIOBuffers);
+            v->write("vSc", vSc);
+            v->write("vBandSc", vBandSc);
+            v->write("vLinked", vLinked);
             v->write("vEmptyBuffer", vEmptyBuffer);
             v->write("vTime", vTime);
             v->write("vBuffer", vBuffer);
+            v->write("vBandSum", vBandSum);
+            v->write("vBandEnv", vBandEnv);
             v->write("vIDisplay", vIDisplay);
 
             v->begin_object("sPremix", &sPremix, sizeof(premix_t));
@@ -1030,13 +3212,15 @@ namespace lsp
                 v->write("fScToIn", sPremix.fScToIn);
                 v->write("fScToLink", sPremix.fScToLink);
 
-                v->writev("vIn", sPremix.vIn, 2);
-                v->writev("vOut", sPremix.vOut, 2);
-                v->writev("vSc", sPremix.vSc, 2);
-                v->writev("vLink", sPremix.vLink, 2);
-                v->writev("vTmpIn", sPremix.vTmpIn, 2);
-                v->writev("vTmpLink", sPremix.vTmpLink, 2);
-                v->writev("vTmpSc", sPremix.vTmpSc, 2);
+                v->writev("vIn", sPremix.vIn, nChannels);
+                v->writev("vOut", sPremix.vOut, nChannels);
+                v->writev("vSc", sPremix.vSc, nChannels);
+                v->writev("vLink", sPremix.vLink, nChannels * meta::ringmod_sc::LINKS_MAX);
+                v->writev("vLinks", sPremix.vLinks, nChannels);
+                v->writev("vTmpIn", sPremix.vTmpIn, nChannels);
+                v->writev("vTmpLink", sPremix.vTmpLink, nChannels);
+                v->writev("vTmpComb", sPremix.vTmpComb, nChannels);
+                v->writev("vTmpSc", sPremix.vTmpSc, nChannels);
 
                 v->write("pInToSc", sPremix.pInToSc);
                 v->write("pInToLink", sPremix.pInToLink);
@@ -1044,28 +3228,89 @@ namespace lsp
                 v->write("pLinkToSc", sPremix.pLinkToSc);
                 v->write("pScToIn", sPremix.pScToIn);
                 v->write("pScToLink", sPremix.pScToLink);
+
+                v->begin_array("vRoutes", sPremix.vRoutes, 2 * PM_TOTAL);
+                {
+                    for (size_t i=0; i<2; ++i)
+                        for (size_t j=0; j<PM_TOTAL; ++j)
+                        {
+                            const premix_route_t *r = &sPremix.vRoutes[i][j];
+
+                            v->begin_object(r, sizeof(premix_route_t));
+                            {
+                                v->write("nOp", r->nOp);
+                                v->writev("vSrc", r->vSrc, PM_TOTAL);
+                                v->writev("vGain", r->vGain, PM_TOTAL);
+                            }
+                            v->end_object();
+                        }
+                }
+                v->end_array();
             }
+            v->end_object();
 
             v->write("nType", nType);
             v->write("nSource", nSource);
             v->write("nLookahead", nLookahead);
             v->write("nDuck", nDuck);
+            v->write("nLkMode", nLkMode);
+            v->write("nLinkMode", nLinkMode);
+            v->write("nOverMode", nOverMode);
+            v->write("nOverTimes", nOverTimes);
+            v->write("nOverLatency", nOverLatency);
+            v->write("nWndTime", nWndTime);
+            v->write("nBands", nBands);
+            v->writev("vSplit", vSplit, meta::ringmod_sc::BANDS_MAX - 1);
+            v->write("nDetMode", nDetMode);
+            v->write("nDetWindow", nDetWindow);
+            v->write("nDetCapacity", nDetCapacity);
             v->write("nHold", nHold);
             v->write("fTauRelease", fTauRelease);
             v->write("fStereoLink", fStereoLink);
-            v->write("fInGain", fInGain);
             v->write("fOutGain", fOutGain);
-            v->write("fScGain", fScGain);
-            v->write("fAmount", fAmount);
-            v->write("fDry", fDry);
-            v->write("fWet", fWet);
+            dump_request(v, "sRequest", &sRequest);
+            dump_request(v, "sTaskRequest", &sTaskRequest);
+            dump_settings(v, "vSettings[0]", &vSettings[0]);
+            dump_settings(v, "vSettings[1]", &vSettings[1]);
+            v->write("pSettings", pSettings);
+            v->write("pPending", pPending);
+            v->write("bSettingsSync", bSettingsSync);
+            dump_ramp(v, "sInGain", &sInGain);
+            dump_ramp(v, "sScGain", &sScGain);
+            dump_ramp(v, "sScOutGain", &sScOutGain);
+            dump_ramp(v, "sAmount", &sAmount);
+            dump_ramp(v, "sDry", &sDry);
+            dump_ramp(v, "sWet", &sWet);
+            v->write("bRampReset", bRampReset);
             v->write("bOutIn", bOutIn);
             v->write("bOutSc", bOutSc);
             v->write("bActive", bActive);
+            v->write("bScFilter", bScFilter);
+            v->write("bCrossSync", bCrossSync);
             v->write("bInvert", bInvert);
+            v->write("bIdle", bIdle);
+            v->write("nIdleSamples", nIdleSamples);
             v->write("bPause", bPause);
             v->write("bClear", bClear);
             v->write("bUISync", bUISync);
+            v->write("bUIActive", bUIActive);
+            v->write("nIDisplayAge", nIDisplayAge);
+            v->write("bMetering", bMetering);
+            v->write("nDotPeriod", nDotPeriod);
+            v->write("nDotPhase", nDotPhase);
+            v->write("nRefreshPeriod", nRefreshPeriod);
+            v->write("nRefreshCounter", nRefreshCounter);
+            v->write("bProfile", bProfile);
+            v->begin_object("sProfile", &sProfile, sizeof(profile_t));
+            {
+                v->writev("vTime", sProfile.vTime, PS_TOTAL);
+                v->writev("vPeak", sProfile.vPeak, PS_TOTAL);
+                v->writev("vCalls", sProfile.vCalls, PS_TOTAL);
+                v->write("nLoadTime", sProfile.nLoadTime);
+                v->write("nLoadSamples", sProfile.nLoadSamples);
+                v->write("fLoad", sProfile.fLoad);
+            }
+            v->end_object();
 
             v->write("pIDisplay", pIDisplay);
 
@@ -1080,10 +3325,21 @@ namespace lsp
             v->write("pType", pType);
             v->write("pSource", pSource);
             v->write("pStereoLink", pStereoLink);
+            v->write("pHpfMode", pHpfMode);
+            v->write("pHpfFreq", pHpfFreq);
+            v->write("pLpfMode", pLpfMode);
+            v->write("pLpfFreq", pLpfFreq);
+            v->write("pDetMode", pDetMode);
+            v->write("pDetWindow", pDetWindow);
             v->write("pHold", pHold);
             v->write("pRelease", pRelease);
             v->write("pLookahead", pLookahead);
             v->write("pDuck", pDuck);
+            v->write("pLkMode", pLkMode);
+            v->write("pLinkMode", pLinkMode);
+            v->write("pOverMode", pOverMode);
+            v->write("pBands", pBands);
+            v->writev("pSplit", pSplit, meta::ringmod_sc::BANDS_MAX - 1);
             v->write("pAmount", pAmount);
             v->write("pDry", pDry);
             v->write("pWet", pWet);
@@ -1091,7 +3347,31 @@ namespace lsp
             v->write("pGraphMesh", pGraphMesh);
             v->write("pPause", pPause);
             v->write("pClear", pClear);
+            v->write("pProfile", pProfile);
+            v->write("pDspLoad", pDspLoad);
             v->write("pData", pData);
+            v->write("pWndData", pWndData);
+            v->write("pDetData", pDetData);
+            v->writev("vOverBuf", vOverBuf, 2);
+            v->write("vOverProd", vOverProd);
+        }
+
+        //---------------------------------------------------------------------
+        // Settings task
+        ringmod_sc::SettingsTask::SettingsTask(ringmod_sc *core)
+        {
+            pCore               = core;
+        }
+
+        ringmod_sc::SettingsTask::~SettingsTask()
+        {
+            pCore               = NULL;
+        }
+
+        status_t ringmod_sc::SettingsTask::run()
+        {
+            compute_settings(pCore->pPending, &pCore->sTaskRequest);
+            return STATUS_OK;
         }
 
     } /* namespace plugins */
@@ -0,0 +1,313 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-ringmod-sc
+ * Created on: 16 окт 2026 г.
+ *
+ * lsp-plugins-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/ipc/Mutex.h>
+#include <lsp-plug.in/ipc/Thread.h>
+#include <lsp-plug.in/lltl/darray.h>
+#include <lsp-plug.in/lltl/parray.h>
+#include <lsp-plug.in/stdlib/stdio.h>
+#include <lsp-plug.in/stdlib/stdlib.h>
+#include <lsp-plug.in/stdlib/string.h>
+
+#include <errno.h>
+
+#include <private/plugins/ringmod_sc_render.h>
+
+namespace lsp
+{
+    namespace
+    {
+        using plugins::ringmod_sc_render;
+
+        typedef struct cmdline_t
+        {
+            const char                         *sConfig;    // Preset file
+            size_t                              nJobs;      // Number of parallel jobs
+            size_t                              nBlockSize; // Number of samples processed at once
+            lltl::darray<ringmod_sc_render::job_t> vJobs;   // List of jobs
+        } cmdline_t;
+
+        /**
+         * Job queue shared between the workers
+         */
+        typedef struct queue_t
+        {
+            ipc::Mutex                          sLock;      // Lock of the queue
+            const cmdline_t                    *pCmd;       // Command line
+            const ringmod_sc_render::preset_t  *pPreset;    // Preset to apply
+            size_t                              nNext;      // Index of the next job
+            size_t                              nFailed;    // Number of failed jobs
+        } queue_t;
+
+        /**
+         * Worker thread, renders jobs from the queue one by one with the same buffers
+         */
+        class Worker: public ipc::Thread
+        {
+            protected:
+                queue_t                *pQueue;
+                ringmod_sc_render       sRender;
+
+            protected:
+                const ringmod_sc_render::job_t *next_job()
+                {
+                    const ringmod_sc_render::job_t *job = NULL;
+
+                    pQueue->sLock.lock();
+                    if (pQueue->nNext < pQueue->pCmd->vJobs.size())
+                        job = pQueue->pCmd->vJobs.uget(pQueue->nNext++);
+                    pQueue->sLock.unlock();
+
+                    return job;
+                }
+
+                void complete_job(const ringmod_sc_render::job_t *job, status_t res)
+                {
+                    pQueue->sLock.lock();
+                    if (res == STATUS_OK)
+                        printf("Rendered '%s' -> '%s'\n", job->sIn, job->sOut);
+                    else
+                    {
+                        fprintf(stderr, "Failed to render '%s' -> '%s': code=%d\n", job->sIn, job->sOut, int(res));
+                        ++pQueue->nFailed;
+                    }
+                    pQueue->sLock.unlock();
+                }
+
+            public:
+                explicit Worker(queue_t *queue)
+                {
+                    pQueue          = queue;
+                }
+
+                bool init(size_t block_size)
+                {
+                    return sRender.init(block_size);
+                }
+
+                virtual status_t run() override
+                {
+                    dsp::context_t ctx;
+                    dsp::start(&ctx);
+                    lsp_finally { dsp::finish(&ctx); };
+
+                    for (const ringmod_sc_render::job_t *job = next_job(); job != NULL; job = next_job())
+                        complete_job(job, sRender.render(job, pQueue->pPreset));
+
+                    return STATUS_OK;
+                }
+        };
+
+        void print_usage(const char *name)
+        {
+            printf("Usage: %s [options] -i <input> [-s <sidechain>] [-l <link>] -o <output> ...\n", name);
+            printf("Render audio files offline through the Ring Modulated Sidechain plugin.\n");
+            printf("\n");
+            printf("Options:\n");
+            printf("  -b, --block <samples>       Number of samples processed at once, default %d\n",
+                int(ringmod_sc_render::BLOCK_SIZE_DFL));
+            printf("  -c, --config <file>         Load plugin settings from the configuration file\n");
+            printf("  -h, --help                  Print this help message\n");
+            printf("  -j, --jobs <number>         Number of files rendered in parallel, default is the number of CPU cores\n");
+            printf("\n");
+            printf("Job options, each output file completes a job:\n");
+            printf("  -i, --input <file>          Input audio file with 1, 2, 6 or 8 channels\n");
+            printf("  -l, --link <file>           Shared memory link audio file, mono and stereo only\n");
+            printf("  -o, --output <file>         Output audio file\n");
+            printf("  -s, --sidechain <file>      Sidechain audio file\n");
+            printf("\n");
+            printf("The sidechain and link files should have the same sample rate as the input file and\n");
+            printf("either one channel or the same number of channels as the input file.\n");
+        }
+
+        bool parse_size(size_t *dst, const char *value)
+        {
+            char *end       = NULL;
+            errno           = 0;
+            long v          = strtol(value, &end, 10);
+            if ((errno != 0) || (end == value) || (*end != '\0') || (v <= 0))
+                return false;
+            *dst            = v;
+            return true;
+        }
+
+        status_t parse_cmdline(cmdline_t *cmd, int argc, const char **argv)
+        {
+            ringmod_sc_render::job_t job;
+            job.sIn         = NULL;
+            job.sSc         = NULL;
+            job.sLink       = NULL;
+            job.sOut        = NULL;
+
+            for (int i=1; i<argc; ++i)
+            {
+                const char *opt = argv[i];
+                if ((!strcmp(opt, "-h")) || (!strcmp(opt, "--help")))
+                {
+                    print_usage(argv[0]);
+                    return STATUS_CANCELLED;
+                }
+
+                if (i + 1 >= argc)
+                {
+                    fprintf(stderr, "Missing value for option '%s'\n", opt);
+                    return STATUS_BAD_ARGUMENTS;
+                }
+                const char *value = argv[++i];
+
+                if ((!strcmp(opt, "-c")) || (!strcmp(opt, "--config")))
+                    cmd->sConfig    = value;
+                else if ((!strcmp(opt, "-j")) || (!strcmp(opt, "--jobs")))
+                {
+                    if (!parse_size(&cmd->nJobs, value))
+                    {
+                        fprintf(stderr, "Invalid number of jobs: '%s'\n", value);
+                        return STATUS_BAD_ARGUMENTS;
+                    }
+                }
+                else if ((!strcmp(opt, "-b")) || (!strcmp(opt, "--block")))
+                {
+                    if (!parse_size(&cmd->nBlockSize, value))
+                    {
+                        fprintf(stderr, "Invalid block size: '%s'\n", value);
+                        return STATUS_BAD_ARGUMENTS;
+                    }
+                }
+                else if ((!strcmp(opt, "-i")) || (!strcmp(opt, "--input")))
+                    job.sIn         = value;
+                else if ((!strcmp(opt, "-s")) || (!strcmp(opt, "--sidechain")))
+                    job.sSc         = value;
+                else if ((!strcmp(opt, "-l")) || (!strcmp(opt, "--link")))
+                    job.sLink       = value;
+                else if ((!strcmp(opt, "-o")) || (!strcmp(opt, "--output")))
+                {
+                    if (job.sIn == NULL)
+                    {
+                        fprintf(stderr, "No input file specified for output file '%s'\n", value);
+                        return STATUS_BAD_ARGUMENTS;
+                    }
+
+                    job.sOut        = value;
+                    if (!cmd->vJobs.add(&job))
+                        return STATUS_NO_MEM;
+
+                    job.sIn         = NULL;
+                    job.sSc         = NULL;
+                    job.sLink       = NULL;
+                    job.sOut        = NULL;
+                }
+                else
+                {
+                    fprintf(stderr, "Unknown option '%s'\n", opt);
+                    return STATUS_BAD_ARGUMENTS;
+                }
+            }
+
+            if ((job.sIn != NULL) || (job.sSc != NULL) || (job.sLink != NULL))
+            {
+                fprintf(stderr, "No output file specified for the last job\n");
+                return STATUS_BAD_ARGUMENTS;
+            }
+            if (cmd->vJobs.is_empty())
+            {
+                print_usage(argv[0]);
+                return STATUS_BAD_ARGUMENTS;
+            }
+
+            return STATUS_OK;
+        }
+
+        int render_main(int argc, const char **argv)
+        {
+            cmdline_t cmd;
+            cmd.sConfig     = NULL;
+            cmd.nJobs       = ipc::Thread::system_cores();
+            cmd.nBlockSize  = ringmod_sc_render::BLOCK_SIZE_DFL;
+
+            status_t res    = parse_cmdline(&cmd, argc, argv);
+            if (res != STATUS_OK)
+                return (res == STATUS_CANCELLED) ? 0 : 1;
+
+            dsp::init();
+
+            // Load the preset
+            ringmod_sc_render::preset_t preset;
+            lsp_finally { ringmod_sc_render::free_preset(&preset); };
+            if ((cmd.sConfig != NULL) && ((res = ringmod_sc_render::load_preset(&preset, cmd.sConfig)) != STATUS_OK))
+            {
+                fprintf(stderr, "Error loading configuration file '%s': code=%d\n", cmd.sConfig, int(res));
+                return 1;
+            }
+
+            // Create workers, each worker owns the buffers for one job
+            queue_t queue;
+            queue.pCmd      = &cmd;
+            queue.pPreset   = &preset;
+            queue.nNext     = 0;
+            queue.nFailed   = 0;
+
+            const size_t workers = lsp_max(lsp_min(cmd.nJobs, cmd.vJobs.size()), size_t(1));
+            lltl::parray<Worker> threads;
+            lsp_finally {
+                for (size_t i=0, n=threads.size(); i<n; ++i)
+                    delete threads.uget(i);
+            };
+
+            for (size_t i=0; i<workers; ++i)
+            {
+                Worker *w = new Worker(&queue);
+                if (!threads.add(w))
+                {
+                    delete w;
+                    return 1;
+                }
+                if (!w->init(cmd.nBlockSize))
+                {
+                    fprintf(stderr, "Not enough memory\n");
+                    return 1;
+                }
+            }
+
+            // Run the workers and wait for completion. The jobs of the worker which
+            // failed to start are rendered by the other workers.
+            size_t started  = 0;
+            for (size_t i=0; i<workers; ++i)
+            {
+                Worker *w = threads.uget(i);
+                if (w->start() == STATUS_OK)
+                    threads.xswap(started++, i);
+            }
+            if (started <= 0)
+                threads.uget(0)->run();
+            for (size_t i=0; i<started; ++i)
+                threads.uget(i)->join();
+
+            return (queue.nFailed > 0) ? 1 : 0;
+        }
+    } /* namespace */
+} /* namespace lsp */
+
+int main(int argc, const char **argv)
+{
+    return lsp::render_main(argc, argv);
+}
@@ -0,0 +1,469 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-ringmod-sc
+ * Created on: 16 окт 2026 г.
+ *
+ * lsp-plugins-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/debug.h>
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/units.h>
+#include <lsp-plug.in/fmt/config/PullParser.h>
+#include <lsp-plug.in/lltl/parray.h>
+#include <lsp-plug.in/plug-fw/meta/func.h>
+#include <lsp-plug.in/stdlib/string.h>
+
+#include <private/plugins/ringmod_sc.h>
+#include <private/plugins/ringmod_sc_render.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        namespace
+        {
+            typedef struct variant_t
+            {
+                const meta::plugin_t   *metadata;
+                uint8_t                 channels;
+                bool                    shm_link;
+            } variant_t;
+
+            // Plugin variants, selected by the number of channels of the input file
+            static const variant_t variants[] =
+            {
+                { &meta::ringmod_sc_mono,       1,  true    },
+                { &meta::ringmod_sc_stereo,     2,  true    },
+                { &meta::ringmod_sc_5_1,        6,  false   },
+                { &meta::ringmod_sc_7_1,        8,  false   },
+
+                { NULL, 0, false }
+            };
+
+            /**
+             * Port which stores the value and the buffer provided by the renderer
+             */
+            class Port: public plug::IPort
+            {
+                protected:
+                    float               fValue;
+                    void               *pBuffer;
+
+                public:
+                    explicit Port(const meta::port_t *meta, void *buffer): plug::IPort(meta)
+                    {
+                        fValue              = meta->start;
+                        pBuffer             = buffer;
+                    }
+
+                public:
+                    virtual float value() override          { return fValue;        }
+                    virtual void set_value(float value) override { fValue = value;  }
+                    virtual void *buffer() override         { return pBuffer;       }
+            };
+
+            /**
+             * Wrapper without executor: the plugin computes all settings synchronously
+             */
+            class Wrapper: public plug::IWrapper
+            {
+                public:
+                    explicit Wrapper(plug::Module *plugin): plug::IWrapper(plugin, NULL) {}
+            };
+
+            const variant_t *find_variant(size_t channels)
+            {
+                for (const variant_t *v = variants; v->metadata != NULL; ++v)
+                    if (v->channels == channels)
+                        return v;
+                return NULL;
+            }
+
+            float port_value(const meta::port_t *port, const ringmod_sc_render::param_t *param)
+            {
+                float value         = param->fValue;
+                if (param->nFlags & config::SF_DECIBELS)
+                {
+                    if (port->unit == meta::U_GAIN_AMP)
+                        value               = dspu::db_to_gain(value);
+                    else if (port->unit == meta::U_GAIN_POW)
+                        value               = dspu::db_to_power(value);
+                }
+
+                return meta::limit_value(port, value);
+            }
+
+            void apply_preset(lltl::parray<plug::IPort> *ports, const ringmod_sc_render::preset_t *preset)
+            {
+                for (size_t i=0, n=preset->size(); i<n; ++i)
+                {
+                    const ringmod_sc_render::param_t *param = preset->uget(i);
+
+                    for (size_t j=0, m=ports->size(); j<m; ++j)
+                    {
+                        plug::IPort *port           = ports->uget(j);
+                        const meta::port_t *meta    = port->metadata();
+                        if ((meta->role != meta::R_CONTROL) && (meta->role != meta::R_BYPASS))
+                            continue;
+                        if (strcmp(meta->id, param->sId) != 0)
+                            continue;
+
+                        port->set_value(port_value(meta, param));
+                        break;
+                    }
+                }
+            }
+
+            void destroy_ports(lltl::parray<plug::IPort> *ports)
+            {
+                for (size_t i=0, n=ports->size(); i<n; ++i)
+                    delete ports->uget(i);
+                ports->flush();
+            }
+        } /* namespace */
+
+        ringmod_sc_render::ringmod_sc_render()
+        {
+            nBlockSize      = 0;
+            vFrame          = NULL;
+            for (size_t i=0; i<CHANNELS_MAX; ++i)
+            {
+                vIn[i]          = NULL;
+                vSc[i]          = NULL;
+                vOut[i]         = NULL;
+            }
+            pData           = NULL;
+        }
+
+        ringmod_sc_render::~ringmod_sc_render()
+        {
+            destroy();
+        }
+
+        bool ringmod_sc_render::init(size_t block_size)
+        {
+            destroy();
+
+            block_size              = lsp_limit(block_size, BLOCK_SIZE_MIN, BLOCK_SIZE_MAX);
+
+            // Allocate the interleaved frame and the planar input, sidechain and output buffers
+            const size_t szof_frame = align_size(sizeof(float) * block_size * CHANNELS_MAX, OPTIMAL_ALIGN);
+            const size_t szof_buf   = align_size(sizeof(float) * block_size, OPTIMAL_ALIGN);
+            uint8_t *ptr            = alloc_aligned<uint8_t>(pData, szof_frame + szof_buf * CHANNELS_MAX * 3, OPTIMAL_ALIGN);
+            if (ptr == NULL)
+                return false;
+
+            vFrame                  = advance_ptr_bytes<float>(ptr, szof_frame);
+            for (size_t i=0; i<CHANNELS_MAX; ++i)
+            {
+                vIn[i]                  = advance_ptr_bytes<float>(ptr, szof_buf);
+                vSc[i]                  = advance_ptr_bytes<float>(ptr, szof_buf);
+                vOut[i]                 = advance_ptr_bytes<float>(ptr, szof_buf);
+                vLink[i].set_size(block_size);
+            }
+            nBlockSize              = block_size;
+
+            return true;
+        }
+
+        void ringmod_sc_render::destroy()
+        {
+            free_aligned(pData);
+            pData           = NULL;
+            vFrame          = NULL;
+            for (size_t i=0; i<CHANNELS_MAX; ++i)
+            {
+                vIn[i]          = NULL;
+                vSc[i]          = NULL;
+                vOut[i]         = NULL;
+                vLink[i].set_size(0);
+            }
+            nBlockSize      = 0;
+        }
+
+        status_t ringmod_sc_render::load_preset(preset_t *preset, const char *path)
+        {
+            config::PullParser parser;
+            status_t res = parser.open(path);
+            if (res != STATUS_OK)
+                return res;
+            lsp_finally { parser.close(); };
+
+            config::param_t param;
+            while ((res = parser.next(&param)) == STATUS_OK)
+            {
+                // Only numeric and boolean parameters are applicable to the plugin ports
+                if ((param.is_string()) || (param.is_blob()))
+                    continue;
+
+                param_t *p = preset->add();
+                if (p == NULL)
+                    return STATUS_NO_MEM;
+                p->sId          = strdup(param.name.get_utf8());
+                p->fValue       = param.to_f32();
+                p->nFlags       = param.flags;
+                if (p->sId == NULL)
+                    return STATUS_NO_MEM;
+            }
+
+            return (res == STATUS_EOF) ? STATUS_OK : res;
+        }
+
+        void ringmod_sc_render::free_preset(preset_t *preset)
+        {
+            for (size_t i=0, n=preset->size(); i<n; ++i)
+            {
+                param_t *p = preset->uget(i);
+                if (p->sId != NULL)
+                    free(p->sId);
+            }
+            preset->flush();
+        }
+
+        status_t ringmod_sc_render::open_source(source_t *src, const char *path, size_t channels, size_t srate)
+        {
+            status_t res = src->sStream.open(path);
+            if (res != STATUS_OK)
+            {
+                fprintf(stderr, "Error opening file '%s': code=%d\n", path, int(res));
+                return res;
+            }
+
+            mm::audio_stream_t info;
+            if ((res = src->sStream.info(&info)) != STATUS_OK)
+                return res;
+
+            // Mono files are sent to all channels
+            if ((info.channels != 1) && (info.channels != channels))
+            {
+                fprintf(stderr, "File '%s' has %d channels, expected 1 or %d\n",
+                    path, int(info.channels), int(channels));
+                return STATUS_BAD_FORMAT;
+            }
+            if (info.srate != srate)
+            {
+                fprintf(stderr, "File '%s' has sample rate %d, expected %d\n",
+                    path, int(info.srate), int(srate));
+                return STATUS_BAD_FORMAT;
+            }
+
+            src->nChannels  = info.channels;
+            src->bEof       = false;
+
+            return STATUS_OK;
+        }
+
+        ssize_t ringmod_sc_render::read_source(source_t *src, float * const *dst, size_t channels)
+        {
+            // Read the block, the stream may return less frames than requested
+            size_t count    = 0;
+            while ((!src->bEof) && (count < nBlockSize))
+            {
+                ssize_t n = src->sStream.read(&vFrame[count * src->nChannels], nBlockSize - count);
+                if (n < 0)
+                {
+                    if (n != -STATUS_EOF)
+                        return n;
+                    src->bEof       = true;
+                }
+                else
+                    count          += n;
+            }
+
+            // Split the frames into channels and pad the tail with silence
+            for (size_t i=0; i<channels; ++i)
+            {
+                float *buf          = dst[i];
+                const float *s      = (src->nChannels == 1) ? vFrame : &vFrame[i];
+                for (size_t j=0; j<count; ++j, s += src->nChannels)
+                    buf[j]              = *s;
+                dsp::fill_zero(&buf[count], nBlockSize - count);
+            }
+
+            return count;
+        }
+
+        status_t ringmod_sc_render::write_output(mm::OutAudioFileStream *os, size_t channels, size_t first, size_t last)
+        {
+            // Interleave the channels
+            for (size_t i=0; i<channels; ++i)
+            {
+                const float *buf    = vOut[i];
+                float *d            = &vFrame[i];
+                for (size_t j=first; j<last; ++j, d += channels)
+                    *d                  = buf[j];
+            }
+
+            // Write the frames
+            for (size_t count = last - first, off = 0; off < count; )
+            {
+                ssize_t n = os->write(&vFrame[off * channels], count - off);
+                if (n < 0)
+                    return -n;
+                off                += n;
+            }
+
+            return STATUS_OK;
+        }
+
+        status_t ringmod_sc_render::render(const job_t *job, const preset_t *preset)
+        {
+            if (pData == NULL)
+                return STATUS_BAD_STATE;
+
+            status_t res;
+            source_t in, sc, lk;
+            lsp_finally {
+                in.sStream.close();
+                sc.sStream.close();
+                lk.sStream.close();
+            };
+
+            // Open the input file and select the plugin variant
+            if ((res = in.sStream.open(job->sIn)) != STATUS_OK)
+            {
+                fprintf(stderr, "Error opening file '%s': code=%d\n", job->sIn, int(res));
+                return res;
+            }
+
+            mm::audio_stream_t info;
+            if ((res = in.sStream.info(&info)) != STATUS_OK)
+                return res;
+            in.nChannels            = info.channels;
+            in.bEof                 = false;
+
+            const variant_t *variant = find_variant(info.channels);
+            if (variant == NULL)
+            {
+                fprintf(stderr, "File '%s' has %d channels, supported layouts are 1, 2, 6 and 8 channels\n",
+                    job->sIn, int(info.channels));
+                return STATUS_UNSUPPORTED_FORMAT;
+            }
+            const size_t channels   = variant->channels;
+
+            // Open the sidechain and the shared memory link
+            const bool has_sc       = job->sSc != NULL;
+            const bool has_link     = job->sLink != NULL;
+            if ((has_link) && (!variant->shm_link))
+            {
+                fprintf(stderr, "The %d-channel plugin has no shared memory link input\n", int(channels));
+                return STATUS_UNSUPPORTED_FORMAT;
+            }
+            if ((has_sc) && ((res = open_source(&sc, job->sSc, channels, info.srate)) != STATUS_OK))
+                return res;
+            if ((has_link) && ((res = open_source(&lk, job->sLink, channels, info.srate)) != STATUS_OK))
+                return res;
+
+            // Create the output file
+            mm::OutAudioFileStream os;
+            mm::audio_stream_t fmt;
+            fmt.srate               = info.srate;
+            fmt.channels            = channels;
+            fmt.frames              = info.frames;
+            fmt.format              = mm::SFMT_F32_CPU;
+            if ((res = os.open(job->sOut, &fmt, mm::AFMT_WAV | mm::CFMT_PCM)) != STATUS_OK)
+            {
+                fprintf(stderr, "Error creating file '%s': code=%d\n", job->sOut, int(res));
+                return res;
+            }
+            lsp_finally { os.close(); };
+
+            // Create the ports
+            lltl::parray<plug::IPort> ports;
+            lsp_finally { destroy_ports(&ports); };
+
+            size_t in_id = 0, sc_id = 0, out_id = 0, link_id = 0;
+            for (const meta::port_t *p = variant->metadata->ports; p->id != NULL; ++p)
+            {
+                void *buf               = NULL;
+                if (p->role == meta::R_AUDIO_IN)
+                    buf                     = (p->flags & meta::F_SIDECHAIN) ? vSc[sc_id++] : vIn[in_id++];
+                else if (p->role == meta::R_AUDIO_OUT)
+                    buf                     = vOut[out_id++];
+                else if ((p->role == meta::R_AUDIO_RETURN) && (has_link) && (link_id < channels))
+                    buf                     = &vLink[link_id++];
+
+                Port *port              = new Port(p, buf);
+                if (!ports.add(port))
+                {
+                    delete port;
+                    return STATUS_NO_MEM;
+                }
+            }
+            for (size_t i=0; i<sc_id; ++i)
+                dsp::fill_zero(vSc[i], nBlockSize);
+            for (size_t i=0; i<link_id; ++i)
+                vLink[i].set_active(true);
+            lsp_finally {
+                for (size_t i=0; i<CHANNELS_MAX; ++i)
+                    vLink[i].set_active(false);
+            };
+
+            if (preset != NULL)
+                apply_preset(&ports, preset);
+
+            // Create the plugin
+            ringmod_sc plugin(variant->metadata, channels, variant->shm_link);
+            Wrapper wrapper(&plugin);
+            plugin.init(&wrapper, ports.array());
+            lsp_finally { plugin.destroy(); };
+
+            plugin.set_sample_rate(info.srate);
+            plugin.update_settings();
+
+            // Stream the files through the plugin. After the end of the input the plugin
+            // processes silence until the delayed tail of the input has been written.
+            float *links[CHANNELS_MAX];
+            for (size_t i=0; i<link_id; ++i)
+                links[i]                = vLink[i].buffer();
+
+            wsize_t consumed        = 0;        // Number of input frames read from the file
+            wsize_t processed       = 0;        // Number of frames processed by the plugin
+            while (true)
+            {
+                ssize_t n           = read_source(&in, vIn, channels);
+                if (n < 0)
+                    return -n;
+                consumed           += n;
+
+                if ((has_sc) && ((n = read_source(&sc, vSc, channels)) < 0))
+                    return -n;
+                if ((has_link) && ((n = read_source(&lk, links, channels)) < 0))
+                    return -n;
+
+                plugin.process(nBlockSize);
+
+                // Skip the samples produced within the latency and drop the samples past the end
+                const wsize_t latency   = plugin.latency();
+                const wsize_t end       = consumed + latency;
+                const size_t first      = (processed < latency) ? lsp_min(latency - processed, wsize_t(nBlockSize)) : 0;
+                const size_t last       = (in.bEof) ? lsp_min(end - processed, wsize_t(nBlockSize)) : nBlockSize;
+                if ((first < last) && ((res = write_output(&os, channels, first, last)) != STATUS_OK))
+                    return res;
+
+                processed          += nBlockSize;
+                if ((in.bEof) && (processed >= end))
+                    break;
+            }
+
+            return os.close();
+        }
+
+    } /* namespace plugins */
+} /* namespace lsp */
@@ -0,0 +1,394 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-ringmod-sc
+ * Created on: 16 окт 2026 г.
+ *
+ * lsp-plugins-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_HELPERS_RINGMOD_SC_H_
+#define TEST_HELPERS_RINGMOD_SC_H_
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/plug-fw/plug.h>
+#include <private/meta/ringmod_sc.h>
+#include <private/plugins/ringmod_sc.h>
+
+#include "ringmod_sc_ref.h"
+
+#include <string.h>
+
+namespace lsp
+{
+    namespace ringmod_sc_test
+    {
+        /**
+         * Port which stores the value and the buffer provided by the test
+         */
+        class Port: public plug::IPort
+        {
+            protected:
+                float               fValue;
+                void               *pBuffer;
+
+            public:
+                explicit Port(const meta::port_t *meta): plug::IPort(meta)
+                {
+                    fValue              = meta->start;
+                    pBuffer             = NULL;
+                }
+
+            public:
+                virtual float value() override          { return fValue;        }
+                virtual void set_value(float value) override { fValue = value;  }
+                virtual void *buffer() override         { return pBuffer;       }
+
+                inline void set_buffer(void *buf)       { pBuffer = buf;        }
+        };
+
+        /**
+         * Wrapper without executor: the settings snapshot is computed synchronously
+         * in the processing thread
+         */
+        class Wrapper: public plug::IWrapper
+        {
+            public:
+                explicit Wrapper(plug::Module *plugin): plug::IWrapper(plugin, NULL) {}
+        };
+
+        /**
+         * Plugin which provides access to the separate processing stages
+         */
+        class Plugin: public plugins::ringmod_sc
+        {
+            protected:
+                static inline float *port_buffer(plug::IPort *port)
+                {
+                    return (port != NULL) ? port->buffer<float>() : NULL;
+                }
+
+            public:
+                /**
+                 * Create the plugin
+                 * @param meta plugin metadata
+                 * @param channels number of audio channels
+                 * @param shm_link shared memory link ports are present
+                 * @param buf_size size of internal buffers, 0 for automatic selection
+                 */
+                explicit Plugin(const meta::plugin_t *meta, size_t channels, bool shm_link, size_t buf_size = 0):
+                    plugins::ringmod_sc(meta, channels, shm_link)
+                {
+                    nBufSize            = buf_size;
+                }
+
+            public:
+                inline size_t   channels() const        { return nChannels;     }
+                inline size_t   buffer_size() const     { return nBufSize;      }
+                inline bool     frontend() const        { return (nChannels == 2) && (nBands <= 1) && (!bScFilter) && (nDetMode == DET_MODE_PEAK); }
+
+                // Host buffers of the channel, NULL if the channel has no such port
+                inline float   *in_buffer(size_t i)     { return port_buffer(vChannels[i].pIn);    }
+                inline float   *out_buffer(size_t i)    { return port_buffer(vChannels[i].pOut);   }
+                inline float   *sc_buffer(size_t i)     { return port_buffer(vChannels[i].pScIn);  }
+
+                /**
+                 * Bind host buffers, reset meters and start parameter ramps in the same way as process() does
+                 * @param samples number of samples in the host block
+                 */
+                void bind(size_t samples)
+                {
+                    for (size_t i=0; i<nChannels; ++i)
+                    {
+                        channel_t *c        = &vChannels[i];
+                        sPremix.vIn[i]      = c->pIn->buffer<float>();
+                        sPremix.vOut[i]     = c->pOut->buffer<float>();
+                        sPremix.vSc[i]      = c->pScIn->buffer<float>();
+                        sPremix.vLinks[i]   = 0;
+
+                        c->vValues[MG_IN]   = GAIN_AMP_M_INF_DB;
+                        c->vValues[MG_SC]   = GAIN_AMP_M_INF_DB;
+                        c->vValues[MG_GAIN] = GAIN_AMP_0_DB;
+                        c->vValues[MG_OUT]  = GAIN_AMP_M_INF_DB;
+                    }
+
+                    start_ramps(samples);
+                    update_metering();
+                }
+
+                void stage_premix(size_t samples)       { premix_channels(vIOBuffers, samples);                 }
+                void stage_frontend(size_t samples)     { process_sidechain_frontend(vSc, vIOBuffers, samples); }
+                void stage_type(size_t samples)         { process_sidechain_type(vSc, vIOBuffers, samples);     }
+                void stage_envelope(size_t samples)     { process_sidechain_envelope(vSc, samples);             }
+                void stage_delays(size_t samples)       { process_sidechain_delays(vSc, samples);               }
+                void stage_link(size_t samples)         { process_sidechain_link(vSc, samples);                 }
+                void stage_apply(size_t samples)        { apply_sidechain_signal(vIOBuffers, samples);          }
+                void stage_meshes()                     { output_meshes(true);                                  }
+
+                /**
+                 * Run all stages over the first chunk of the host block so that the
+                 * internal buffers of each stage refer to the valid data
+                 * @param samples number of samples in the host block
+                 */
+                void prime(size_t samples)
+                {
+                    const size_t count  = lsp_min(samples, size_t(nBufSize));
+
+                    bind(samples);
+                    premix_channels(vIOBuffers, count);
+                    if (!process_sidechain_frontend(vSc, vIOBuffers, count))
+                    {
+                        process_sidechain_type(vSc, vIOBuffers, count);
+                        process_sidechain_envelope(vSc, count);
+                    }
+                    process_sidechain_delays(vSc, count);
+                    if (nChannels > 1)
+                        process_sidechain_link(vSc, count);
+                    apply_sidechain_signal(vIOBuffers, count);
+                    complete_ramps();
+                }
+        };
+
+        /**
+         * Test harness: instantiates the plugin, the wrapper and all ports
+         * declared by the plugin metadata
+         */
+        class Harness
+        {
+            protected:
+                const meta::plugin_t   *pMeta;
+                Plugin                 *pPlugin;
+                Wrapper                *pWrapper;
+                plug::IPort           **vPorts;
+                size_t                  nPorts;
+                size_t                  nCapacity;
+                plug::mesh_t           *pMesh;
+                uint8_t                *pData;
+                uint8_t                *pMeshData;
+
+            public:
+                explicit Harness()
+                {
+                    pMeta               = NULL;
+                    pPlugin             = NULL;
+                    pWrapper            = NULL;
+                    vPorts              = NULL;
+                    nPorts              = 0;
+                    nCapacity           = 0;
+                    pMesh               = NULL;
+                    pData               = NULL;
+                    pMeshData           = NULL;
+                }
+
+                Harness(const Harness &) = delete;
+                Harness(Harness &&) = delete;
+                Harness & operator = (const Harness &) = delete;
+                Harness & operator = (Harness &&) = delete;
+
+                ~Harness()
+                {
+                    destroy();
+                }
+
+            public:
+                /**
+                 * Create the plugin and the ports
+                 * @param meta plugin metadata
+                 * @param channels number of audio channels
+                 * @param shm_link shared memory link ports are present
+                 * @param capacity maximum size of the host block
+                 * @param buf_size size of internal buffers of the plugin, 0 for automatic selection
+                 * @return true on success
+                 */
+                bool init(const meta::plugin_t *meta, size_t channels, bool shm_link, size_t capacity, size_t buf_size = 0)
+                {
+                    destroy();
+
+                    // Count ports and audio ports
+                    size_t audio        = 0;
+                    for (const meta::port_t *p = meta->ports; p->id != NULL; ++p)
+                    {
+                        ++nPorts;
+                        if ((p->role == meta::R_AUDIO_IN) || (p->role == meta::R_AUDIO_OUT))
+                            ++audio;
+                    }
+
+                    // Allocate port list and audio buffers
+                    const size_t szof_ports = align_size(sizeof(plug::IPort *) * nPorts, DEFAULT_ALIGN);
+                    const size_t buf_sz     = align_size(sizeof(float) * capacity, OPTIMAL_ALIGN);
+                    uint8_t *ptr        = alloc_aligned<uint8_t>(pData, szof_ports + buf_sz * audio, OPTIMAL_ALIGN);
+                    if (ptr == NULL)
+                        return false;
+                    vPorts              = advance_ptr_bytes<plug::IPort *>(ptr, szof_ports);
+                    nCapacity           = capacity;
+
+                    // Allocate the mesh: time and MG_TOTAL graphs per channel
+                    const size_t mesh_bufs  = 1 + channels * 4;
+                    const size_t mesh_items = meta::ringmod_sc::TIME_MESH_SIZE + 4;
+                    const size_t szof_mesh  = align_size(sizeof(plug::mesh_t) + sizeof(float *) * mesh_bufs, OPTIMAL_ALIGN);
+                    const size_t mesh_sz    = align_size(sizeof(float) * mesh_items, OPTIMAL_ALIGN);
+                    uint8_t *mptr       = alloc_aligned<uint8_t>(pMeshData, szof_mesh + mesh_sz * mesh_bufs, OPTIMAL_ALIGN);
+                    if (mptr == NULL)
+                        return false;
+                    pMesh               = advance_ptr_bytes<plug::mesh_t>(mptr, szof_mesh);
+                    for (size_t i=0; i<mesh_bufs; ++i)
+                        pMesh->pvData[i]    = advance_ptr_bytes<float>(mptr, mesh_sz);
+                    pMesh->cleanup();
+
+                    // Create ports
+                    size_t port_id      = 0;
+                    for (const meta::port_t *p = meta->ports; p->id != NULL; ++p, ++port_id)
+                    {
+                        Port *port          = new Port(p);
+                        vPorts[port_id]     = port;
+
+                        if ((p->role == meta::R_AUDIO_IN) || (p->role == meta::R_AUDIO_OUT))
+                        {
+                            float *buf          = advance_ptr_bytes<float>(ptr, buf_sz);
+                            dsp::fill_zero(buf, capacity);
+                            port->set_buffer(buf);
+                        }
+                        else if (p->role == meta::R_MESH)
+                            port->set_buffer(pMesh);
+                    }
+
+                    // Create and initialize the plugin
+                    pMeta               = meta;
+                    pPlugin             = new Plugin(meta, channels, shm_link, buf_size);
+                    pWrapper            = new Wrapper(pPlugin);
+                    pPlugin->init(pWrapper, vPorts);
+
+                    return true;
+                }
+
+                void destroy()
+                {
+                    if (pPlugin != NULL)
+                    {
+                        pPlugin->destroy();
+                        delete pPlugin;
+                        pPlugin             = NULL;
+                    }
+                    if (pWrapper != NULL)
+                    {
+                        delete pWrapper;
+                        pWrapper            = NULL;
+                    }
+                    if (vPorts != NULL)
+                    {
+                        for (size_t i=0; i<nPorts; ++i)
+                            delete vPorts[i];
+                        vPorts              = NULL;
+                    }
+                    nPorts              = 0;
+                    nCapacity           = 0;
+                    pMesh               = NULL;
+                    pMeta               = NULL;
+
+                    free_aligned(pData);
+                    free_aligned(pMeshData);
+                    pData               = NULL;
+                    pMeshData           = NULL;
+                }
+
+            public:
+                inline Plugin  *plugin()                { return pPlugin;       }
+                inline size_t   capacity() const        { return nCapacity;     }
+
+                /**
+                 * Find port by identifier
+                 * @param id port identifier
+                 * @return port or NULL if there is no such port
+                 */
+                Port *port(const char *id)
+                {
+                    for (size_t i=0; i<nPorts; ++i)
+                        if (!strcmp(vPorts[i]->metadata()->id, id))
+                            return static_cast<Port *>(vPorts[i]);
+                    return NULL;
+                }
+
+                /**
+                 * Set value of the port, nothing is done if there is no such port
+                 * @param id port identifier
+                 * @param value value to set
+                 */
+                void set(const char *id, float value)
+                {
+                    Port *p = port(id);
+                    if (p != NULL)
+                        p->set_value(value);
+                }
+
+                /**
+                 * Get the buffer of the audio port
+                 * @param id port identifier
+                 * @return buffer or NULL if there is no such port
+                 */
+                float *audio(const char *id)
+                {
+                    Port *p = port(id);
+                    return (p != NULL) ? static_cast<float *>(p->buffer()) : NULL;
+                }
+
+                /**
+                 * Fill all audio inputs with pseudo-random signal
+                 * @param amp amplitude of the signal
+                 * @param seed state of the generator, updated after the call
+                 */
+                void randomize_inputs(float amp, uint32_t & seed)
+                {
+                    for (size_t i=0; i<nPorts; ++i)
+                    {
+                        const meta::port_t *meta    = vPorts[i]->metadata();
+                        if (meta->role != meta::R_AUDIO_IN)
+                            continue;
+                        float *buf = static_cast<float *>(vPorts[i]->buffer());
+                        if (buf != NULL)
+                            randomize(buf, nCapacity, amp, seed);
+                    }
+                }
+
+                /**
+                 * Mark the mesh as consumed by the UI
+                 */
+                void consume_mesh()
+                {
+                    if (pMesh != NULL)
+                        pMesh->cleanup();
+                }
+
+                void set_sample_rate(long sr)
+                {
+                    pPlugin->set_sample_rate(sr);
+                }
+
+                void update_settings()
+                {
+                    pPlugin->update_settings();
+                }
+
+                void process(size_t samples)
+                {
+                    pPlugin->process(samples);
+                }
+        };
+
+    } /* namespace ringmod_sc_test */
+} /* namespace lsp */
+
+#endif /* TEST_HELPERS_RINGMOD_SC_H_ */
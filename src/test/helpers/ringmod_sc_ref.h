@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-ringmod-sc
+ * Created on: 16 окт 2026 г.
+ *
+ * lsp-plugins-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_HELPERS_RINGMOD_SC_REF_H_
+#define TEST_HELPERS_RINGMOD_SC_REF_H_
+
+#include <lsp-plug.in/common/types.h>
+#include <private/plugins/ringmod_sc_kernels.h>
+
+namespace lsp
+{
+    namespace ringmod_sc_test
+    {
+        // Maximum number of channels supported by the reference implementation
+        static constexpr size_t REF_CHANNELS_MAX    = 8;
+
+        // Values of the sidechain type port
+        enum ref_type_t
+        {
+            REF_TYPE_INTERNAL,
+            REF_TYPE_EXTERNAL,
+            REF_TYPE_SHM_LINK,
+            REF_TYPE_ENVELOPE,
+
+            REF_TYPE_TOTAL
+        };
+
+        // Values of the sidechain source port
+        enum ref_source_t
+        {
+            REF_SRC_LEFT_RIGHT,
+            REF_SRC_RIGHT_LEFT,
+            REF_SRC_LEFT,
+            REF_SRC_RIGHT,
+            REF_SRC_MID_SIDE,
+            REF_SRC_SIDE_MID,
+            REF_SRC_MIDDLE,
+            REF_SRC_SIDE,
+            REF_SRC_MIN,
+            REF_SRC_MAX,
+
+            REF_SRC_TOTAL
+        };
+
+        /**
+         * Configuration of the reference processing. Gains are at 0 dB, the dry/wet
+         * balance is 100% wet with muted dry signal, there is no pre-mix, no shared
+         * memory links connected, no lookahead, no filters and no oversampling.
+         */
+        typedef struct ref_config_t
+        {
+            size_t              nChannels;              // Number of channels
+            size_t              nType;                  // Sidechain type, see ref_type_t
+            size_t              nSource;                // Sidechain source, see ref_source_t
+            bool                bInvert;                // Invert sidechain processing
+            bool                bOutIn;                 // Output input signal
+            bool                bOutSc;                 // Output sidechain signal
+            bool                bActive;                // Sidechain processing is active
+            float               fSampleRate;            // Sample rate
+            float               fHold;                  // Hold time in milliseconds
+            float               fRelease;               // Release time in milliseconds
+            float               fStereoLink;            // Stereo link in percents, applied to stereo only
+        } ref_config_t;
+
+        /**
+         * Fill buffer with deterministic pseudo-random values in range [-amp, +amp]
+         * @param dst destination buffer
+         * @param count number of samples
+         * @param amp amplitude
+         * @param seed state of the generator, updated after the call
+         */
+        inline void randomize(float *dst, size_t count, float amp, uint32_t & seed)
+        {
+            for (size_t i=0; i<count; ++i)
+            {
+                seed            = seed * 1664525u + 1013904223u;
+                dst[i]          = amp * (float(seed >> 8) * (2.0f / float(1 << 24)) - 1.0f);
+            }
+        }
+
+        /**
+         * Generate test signals: noise on the input and bursts of noise on the sidechain,
+         * so hold and release of the envelope follower take effect
+         * @param in input buffers, one per channel
+         * @param sc sidechain buffers, one per channel
+         * @param channels number of channels
+         * @param count number of samples
+         * @param seed state of the generator, updated after the call
+         */
+        inline void ref_signals(float * const *in, float * const *sc, size_t channels, size_t count, uint32_t & seed)
+        {
+            for (size_t i=0; i<channels; ++i)
+                randomize(in[i], count, 0.5f, seed);
+            for (size_t i=0; i<channels; ++i)
+            {
+                randomize(sc[i], count, 1.0f, seed);
+                for (size_t j=0; j<count; ++j)
+                    sc[i][j]       *= (((j + i * 5) & 0x1f) < 6) ? 1.0f : 0.05f;
+            }
+        }
+
+        /**
+         * Transform the stereo sidechain signal according to the sidechain source
+         */
+        inline void ref_source(float &a, float &b, float l, float r, size_t source)
+        {
+            switch (source)
+            {
+                case REF_SRC_RIGHT_LEFT:    a = r; b = l; break;
+                case REF_SRC_LEFT:          a = l; b = l; break;
+                case REF_SRC_RIGHT:         a = r; b = r; break;
+                case REF_SRC_MID_SIDE:      a = (l + r) * 0.5f; b = (l - r) * 0.5f; break;
+                case REF_SRC_SIDE_MID:      a = (l - r) * 0.5f; b = (l + r) * 0.5f; break;
+                case REF_SRC_MIDDLE:        a = (l + r) * 0.5f; b = a; break;
+                case REF_SRC_SIDE:          a = (l - r) * 0.5f; b = a; break;
+                case REF_SRC_MIN:           a = lsp_min(fabsf(l), fabsf(r)); b = a; break;
+                case REF_SRC_MAX:           a = lsp_max(fabsf(l), fabsf(r)); b = a; break;
+                case REF_SRC_LEFT_RIGHT:
+                default:                    a = l; b = r; break;
+            }
+        }
+
+        /**
+         * Scalar reference implementation of the plugin, one sample at a time
+         *
+         * @param out output buffers, one per channel
+         * @param in input buffers, one per channel
+         * @param sc sidechain buffers, one per channel
+         * @param cfg configuration
+         * @param samples number of samples to process
+         */
+        inline void ref_process(
+            float * const *out, const float * const *in, const float * const *sc,
+            const ref_config_t *cfg, size_t samples)
+        {
+            using namespace plugins::ringmod_sc_kernels;
+
+            const size_t channels   = cfg->nChannels;
+            const float tau         = release_tau(cfg->fSampleRate, cfg->fRelease);
+            const uint32_t hold_max = dspu::millis_to_samples(cfg->fSampleRate, cfg->fHold);
+            const float link        = lsp_max(cfg->fStereoLink * 0.01f, 0.0f);
+
+            float peak[REF_CHANNELS_MAX];
+            uint32_t hold[REF_CHANNELS_MAX];
+            for (size_t i=0; i<channels; ++i)
+            {
+                peak[i]                 = 0.0f;
+                hold[i]                 = 0;
+            }
+
+            for (size_t j=0; j<samples; ++j)
+            {
+                // Select the raw sidechain signal of each channel
+                float raw[REF_CHANNELS_MAX];
+                for (size_t i=0; i<channels; ++i)
+                {
+                    raw[i]                  = 0.0f;
+                    switch (cfg->nType)
+                    {
+                        case REF_TYPE_INTERNAL: raw[i] = in[i][j]; break;
+                        case REF_TYPE_EXTERNAL: raw[i] = sc[i][j]; break;
+                        case REF_TYPE_ENVELOPE: raw[i] = sc[i][j]; break;
+                        default: break;
+                    }
+                }
+
+                // Compute the envelope, the received envelope is silent without links
+                float env[REF_CHANNELS_MAX];
+                for (size_t i=0; i<channels; ++i)
+                    env[i]                  = 0.0f;
+
+                if (cfg->nType != REF_TYPE_ENVELOPE)
+                {
+                    // The sidechain source is applied to stereo only
+                    float s[REF_CHANNELS_MAX];
+                    for (size_t i=0; i<channels; ++i)
+                        s[i]                    = raw[i];
+                    if (channels == 2)
+                        ref_source(s[0], s[1], raw[0], raw[1], cfg->nSource);
+
+                    for (size_t i=0; i<channels; ++i)
+                        env[i]                  = envelope_step(fabsf(s[i] * GAIN_AMP_0_DB), peak[i], hold[i], hold_max, tau);
+
+                    // Raise the lower envelope to the higher one
+                    if ((channels == 2) && (link > 0.0f))
+                    {
+                        if (env[0] < env[1])
+                            env[0]                  = env[0] + (env[1] - env[0]) * link;
+                        else
+                            env[1]                  = env[1] + (env[0] - env[1]) * link;
+                    }
+                }
+
+                // Apply gain reduction and mix the output signal
+                for (size_t i=0; i<channels; ++i)
+                {
+                    const float x           = in[i][j] * GAIN_AMP_0_DB;
+                    const float g           = (cfg->bInvert) ?
+                                                gain_reduction<true>(env[i], GAIN_AMP_0_DB) :
+                                                gain_reduction<false>(env[i], GAIN_AMP_0_DB);
+                    float y                 = (cfg->bOutIn) ?
+                                                ((cfg->bActive) ? mix(g, x, 0.0f, GAIN_AMP_0_DB) : x) :
+                                                0.0f;
+                    if (cfg->bOutSc)
+                        y                      += raw[i] * GAIN_AMP_0_DB;
+                    out[i][j]               = y;
+                }
+            }
+        }
+
+    } /* namespace ringmod_sc_test */
+} /* namespace lsp */
+
+#endif /* TEST_HELPERS_RINGMOD_SC_REF_H_ */
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-ringmod-sc
+ * Created on: 16 окт 2026 г.
+ *
+ * lsp-plugins-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+
+#include "../helpers/ringmod_sc.h"
+
+#include <stdio.h>
+#include <time.h>
+
+// Host block sizes: 1 << MIN_RANK .. 1 << MAX_RANK samples
+#define MIN_RANK        9
+#define MAX_RANK        13
+// Sample rate
+#define SAMPLE_RATE     48000
+
+namespace
+{
+    using namespace lsp;
+
+    typedef struct layout_t
+    {
+        const meta::plugin_t   *pMeta;
+        size_t                  nChannels;
+    } layout_t;
+
+    static const layout_t layouts[] =
+    {
+        { &meta::ringmod_sc_mono,   1 },
+        { &meta::ringmod_sc_stereo, 2 },
+        { &meta::ringmod_sc_5_1,    6 },
+        { &meta::ringmod_sc_7_1,    8 }
+    };
+
+    // Internal buffer sizes, 0 stands for the size selected by the plugin
+    static const size_t buffer_sizes[] =
+    {
+        0, 0x100, 0x200, 0x400, 0x800, 0x1000
+    };
+
+    static uint64_t monotonic_time()
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return uint64_t(ts.tv_sec) * 1000000000u + uint64_t(ts.tv_nsec);
+    }
+}
+
+PTEST_BEGIN("plugins.ringmod_sc", buffer_size, 0.2f, 8)
+
+    void call(ringmod_sc_test::Harness *h, bool selected, size_t samples)
+    {
+        ringmod_sc_test::Plugin *p  = h->plugin();
+        const size_t channels       = p->channels();
+        const size_t buf_size       = p->buffer_size();
+
+        char buf[160];
+        snprintf(buf, sizeof(buf), "ch=%d block=%d buffer=%d%s",
+            int(channels), int(samples), int(buf_size), (selected) ? " (selected)" : "");
+        printf("Testing %s...\n", buf);
+
+        // Warm up
+        for (size_t i=0; i<4; ++i)
+            h->process(samples);
+
+        size_t calls            = 0;
+        const uint64_t start    = monotonic_time();
+        PTEST_LOOP(buf,
+            h->process(samples);
+            ++calls;
+        );
+        const uint64_t time     = monotonic_time() - start;
+
+        // Machine-readable result, one line per measurement
+        const double ns         = (calls > 0) ? double(time) / double(calls * samples) : 0.0;
+        printf("BUFFER_NS,%d,%d,%d,%d,%.4f\n",
+            int(channels), int(samples), int(buf_size), int(selected), ns);
+    }
+
+    PTEST_MAIN
+    {
+        const size_t capacity           = size_t(1) << MAX_RANK;
+        uint32_t seed                   = 0x1234;
+
+        printf("BUFFER_NS,channels,block,buffer_size,selected,ns_per_sample\n");
+
+        for (size_t i=0; i<sizeof(layouts)/sizeof(layouts[0]); ++i)
+        {
+            const layout_t *l   = &layouts[i];
+            for (size_t j=0; j<sizeof(buffer_sizes)/sizeof(buffer_sizes[0]); ++j)
+            {
+                ringmod_sc_test::Harness h;
+                if (!h.init(l->pMeta, l->nChannels, true, capacity, buffer_sizes[j]))
+                    return;
+
+                h.set("type", 1.0f);           // External sidechain
+                h.set("hold", 2.0f);
+                h.set("release", 20.0f);
+                h.set("slink", 50.0f);
+                h.randomize_inputs(0.5f, seed);
+                h.set_sample_rate(SAMPLE_RATE);
+                h.update_settings();
+
+                for (size_t rank=MIN_RANK; rank <= MAX_RANK; ++rank)
+                    call(&h, buffer_sizes[j] == 0, size_t(1) << rank);
+                PTEST_SEPARATOR;
+            }
+        }
+    }
+
+PTEST_END
@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-ringmod-sc
+ * Created on: 16 окт 2026 г.
+ *
+ * lsp-plugins-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+
+#include "../helpers/ringmod_sc.h"
+
+#include <stdio.h>
+#include <time.h>
+
+// Host block sizes: 1 << MIN_RANK .. 1 << MAX_RANK samples
+#define MIN_RANK        0
+#define MAX_RANK        13
+
+namespace
+{
+    using namespace lsp;
+
+    enum stage_t
+    {
+        ST_PREMIX,
+        ST_TYPE,
+        ST_FRONTEND,
+        ST_ENVELOPE,
+        ST_DELAYS,
+        ST_LINK,
+        ST_APPLY,
+        ST_MESHES,
+        ST_PROCESS,
+
+        ST_TOTAL
+    };
+
+    static const char *stage_names[] =
+    {
+        "premix_channels",
+        "process_sidechain_type",
+        "process_sidechain_frontend",
+        "process_sidechain_envelope",
+        "process_sidechain_delays",
+        "process_sidechain_link",
+        "apply_sidechain_signal",
+        "output_meshes",
+        "process"
+    };
+
+    static const char *source_names[] =
+    {
+        "left_right",
+        "right_left",
+        "left",
+        "right",
+        "mid_side",
+        "side_mid",
+        "middle",
+        "side",
+        "min",
+        "max"
+    };
+
+    static const long sample_rates[] =
+    {
+        44100, 48000, 88200, 96000, 176400, 192000, 352800, 384000
+    };
+
+    static uint64_t monotonic_time()
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return uint64_t(ts.tv_sec) * 1000000000u + uint64_t(ts.tv_nsec);
+    }
+
+    /**
+     * Execute the stage for the whole host block split into chunks of the internal buffer size
+     */
+    static void run_stage(ringmod_sc_test::Harness *h, size_t stage, size_t samples)
+    {
+        ringmod_sc_test::Plugin *p  = h->plugin();
+        const size_t buf_size       = p->buffer_size();
+
+        switch (stage)
+        {
+            case ST_MESHES:
+                h->consume_mesh();
+                p->stage_meshes();
+                return;
+            case ST_PROCESS:
+                h->process(samples);
+                return;
+            case ST_PREMIX:
+                p->bind(samples);
+                break;
+            default:
+                break;
+        }
+
+        for (size_t offset=0; offset < samples; )
+        {
+            const size_t count  = lsp_min(samples - offset, buf_size);
+            switch (stage)
+            {
+                case ST_PREMIX:     p->stage_premix(count);     break;
+                case ST_TYPE:       p->stage_type(count);       break;
+                case ST_FRONTEND:   p->stage_frontend(count);   break;
+                case ST_ENVELOPE:   p->stage_envelope(count);   break;
+                case ST_DELAYS:     p->stage_delays(count);     break;
+                case ST_LINK:       p->stage_link(count);       break;
+                case ST_APPLY:      p->stage_apply(count);      break;
+                default: break;
+            }
+            offset     += count;
+        }
+    }
+}
+
+PTEST_BEGIN("plugins.ringmod_sc", stages, 0.05f, 8)
+
+    void call(ringmod_sc_test::Harness *h, size_t stage, size_t source, long sr, size_t samples)
+    {
+        ringmod_sc_test::Plugin *p  = h->plugin();
+        const size_t channels       = p->channels();
+
+        char buf[160];
+        snprintf(buf, sizeof(buf), "%s ch=%d src=%s sr=%ld block=%d",
+            stage_names[stage], int(channels), source_names[source], sr, int(samples));
+        printf("Testing %s...\n", buf);
+
+        // Warm up and make internal buffers refer to valid data
+        for (size_t i=0; i<4; ++i)
+            h->process(samples);
+        p->prime(samples);
+
+        size_t calls            = 0;
+        const uint64_t start    = monotonic_time();
+        PTEST_LOOP(buf,
+            run_stage(h, stage, samples);
+            ++calls;
+        );
+        const uint64_t time     = monotonic_time() - start;
+
+        // Machine-readable result, one line per measurement
+        const double ns         = (calls > 0) ? double(time) / double(calls * samples) : 0.0;
+        printf("STAGE_NS,%s,%d,%s,%d,%ld,%d,%.4f\n",
+            stage_names[stage], int(channels), source_names[source],
+            int(samples), sr, int(p->buffer_size()), ns);
+    }
+
+    void sweep(ringmod_sc_test::Harness *h, size_t source)
+    {
+        ringmod_sc_test::Plugin *p  = h->plugin();
+        const size_t channels       = p->channels();
+
+        h->set("source", source);
+        h->update_settings();
+
+        for (size_t i=0; i<sizeof(sample_rates)/sizeof(sample_rates[0]); ++i)
+        {
+            const long sr = sample_rates[i];
+            h->set_sample_rate(sr);
+            h->update_settings();
+
+            for (size_t rank=MIN_RANK; rank <= MAX_RANK; ++rank)
+            {
+                const size_t samples    = size_t(1) << rank;
+                for (size_t stage=0; stage < ST_TOTAL; ++stage)
+                {
+                    // The fused front-end and the stereo link exist only for stereo
+                    if ((channels < 2) && ((stage == ST_FRONTEND) || (stage == ST_LINK)))
+                        continue;
+                    call(h, stage, source, sr, samples);
+                }
+                PTEST_SEPARATOR;
+            }
+        }
+    }
+
+    void setup(ringmod_sc_test::Harness *h)
+    {
+        h->set("type", 1.0f);           // External sidechain
+        h->set("hold", 2.0f);
+        h->set("release", 20.0f);
+        h->set("lk", 2.0f);
+        h->set("duck", 1.0f);
+        h->set("slink", 50.0f);
+    }
+
+    PTEST_MAIN
+    {
+        const size_t capacity           = size_t(1) << MAX_RANK;
+        uint32_t seed                   = 0x1234;
+
+        printf("STAGE_NS,stage,channels,source,block,sample_rate,buffer_size,ns_per_sample\n");
+
+        // Mono: the sidechain source is not applicable
+        {
+            ringmod_sc_test::Harness h;
+            if (!h.init(&meta::ringmod_sc_mono, 1, true, capacity))
+                return;
+            setup(&h);
+            h.randomize_inputs(0.5f, seed);
+            sweep(&h, 0);
+        }
+
+        // Stereo: all sidechain sources
+        {
+            ringmod_sc_test::Harness h;
+            if (!h.init(&meta::ringmod_sc_stereo, 2, true, capacity))
+                return;
+            setup(&h);
+            h.randomize_inputs(0.5f, seed);
+            for (size_t source=0; source < sizeof(source_names)/sizeof(source_names[0]); ++source)
+                sweep(&h, source);
+        }
+    }
+
+PTEST_END
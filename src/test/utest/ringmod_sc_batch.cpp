@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-ringmod-sc
+ * Created on: 16 окт 2026 г.
+ *
+ * lsp-plugins-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+
+#include <private/plugins/ringmod_sc_batch.h>
+
+#include "../helpers/ringmod_sc.h"
+
+// Maximum size of the host block
+#define BLOCK_SIZE          1024
+// Number of samples rendered by each strip
+#define SIGNAL_SIZE         4096
+// Number of silent samples processed by the plugin before the test signal
+#define WARMUP_SIZE         8192
+// Sample rate
+#define SAMPLE_RATE         48000
+// Absolute tolerance between the batch processor and the plugin, the results differ by rounding only
+#define TOLERANCE           1e-5f
+
+namespace
+{
+    using namespace lsp;
+    using namespace lsp::ringmod_sc_test;
+
+    typedef struct strip_params_t
+    {
+        float               fInGain;                // Input gain
+        float               fScGain;                // Sidechain gain
+        float               fHold;                  // Hold time in milliseconds
+        float               fRelease;               // Release time in milliseconds
+        float               fAmount;                // Amount in decibels
+        float               fDry;                   // Dry gain
+        float               fWet;                   // Wet gain
+        bool                bInvert;                // Invert sidechain processing
+    } strip_params_t;
+
+    // The number of strips is not a multiple of the number of lanes, so the padding lanes are tested too
+    static const strip_params_t strips[] =
+    {
+        { 1.0f,     1.0f,       0.0f,   0.0f,       0.0f,   0.0f,   1.0f,   false   },
+        { 1.0f,     1.0f,       0.1f,   1.0f,       0.0f,   0.0f,   1.0f,   true    },
+        { 0.5f,     2.0f,       2.0f,   20.0f,      6.0f,   0.0f,   1.0f,   false   },
+        { 2.0f,     0.5f,       0.0f,   5.0f,       -6.0f,  0.25f,  0.75f,  true    },
+        { 1.0f,     1.0f,       10.0f,  100.0f,     24.0f,  0.0f,   1.0f,   false   },
+        { 1.0f,     4.0f,       0.5f,   0.5f,       -12.0f, 1.0f,   0.5f,   false   },
+        { 0.25f,    1.0f,       1.0f,   50.0f,      12.0f,  0.5f,   0.5f,   true    },
+        { 1.0f,     0.25f,      5.0f,   10.0f,      3.0f,   0.0f,   2.0f,   false   },
+        { 1.5f,     1.5f,       0.2f,   2.0f,       0.0f,   0.1f,   1.0f,   true    },
+        { 1.0f,     1.0f,       0.0f,   30.0f,      -3.0f,  0.0f,   1.0f,   false   },
+        { 0.75f,    3.0f,       3.0f,   3.0f,       9.0f,   0.3f,   0.3f,   true    }
+    };
+
+    static constexpr size_t STRIPS  = sizeof(strips) / sizeof(strips[0]);
+
+    // Host block sizes, cycled while rendering the signal
+    static const size_t block_sizes[] =
+    {
+        1, 7, 64, 333, 1024, 2, 513, 31, 256, 1000
+    };
+}
+
+UTEST_BEGIN("plugins.ringmod_sc", batch)
+
+    void set_port(Harness *h, const char *id, float value)
+    {
+        UTEST_ASSERT_MSG(h->port(id) != NULL, "Missing port '%s'", id);
+        h->set(id, value);
+    }
+
+    /**
+     * Render the signal of the strip through the mono plugin with external sidechain
+     */
+    void render_plugin(float *out, const float *in, const float *sc, const strip_params_t *s)
+    {
+        Harness h;
+        UTEST_ASSERT(h.init(&meta::ringmod_sc_mono, 1, true, BLOCK_SIZE));
+        Plugin *p               = h.plugin();
+
+        set_port(&h, "type", 1.0f);         // External sidechain
+        set_port(&h, "g_in", s->fInGain);
+        set_port(&h, "g_sc", s->fScGain);
+        set_port(&h, "hold", s->fHold);
+        set_port(&h, "release", s->fRelease);
+        set_port(&h, "amount", s->fAmount);
+        set_port(&h, "dry", s->fDry);
+        set_port(&h, "wet", s->fWet);
+        set_port(&h, "drywet", 100.0f);
+        set_port(&h, "invert", (s->bInvert) ? 1.0f : 0.0f);
+        set_port(&h, "out_in", 1.0f);
+        set_port(&h, "out_sc", 0.0f);
+        set_port(&h, "active", 1.0f);
+        h.set_sample_rate(SAMPLE_RATE);
+        h.update_settings();
+
+        // Let the bypass switch and the parameter ramps settle on silence
+        for (size_t offset=0; offset < WARMUP_SIZE; offset += BLOCK_SIZE)
+            h.process(BLOCK_SIZE);
+
+        for (size_t offset=0, k=0; offset < SIGNAL_SIZE; ++k)
+        {
+            const size_t count  = lsp_min(block_sizes[k % (sizeof(block_sizes)/sizeof(block_sizes[0]))], SIGNAL_SIZE - offset);
+            dsp::copy(p->in_buffer(0), &in[offset], count);
+            dsp::copy(p->sc_buffer(0), &sc[offset], count);
+            h.process(count);
+            dsp::copy(&out[offset], p->out_buffer(0), count);
+            offset     += count;
+        }
+    }
+
+    UTEST_MAIN
+    {
+        // Allocate buffers
+        float *vIn[STRIPS], *vSc[STRIPS], *vOut[STRIPS], *vRef[STRIPS];
+        uint8_t *data           = NULL;
+        const size_t buf_sz     = align_size(sizeof(float) * SIGNAL_SIZE, OPTIMAL_ALIGN);
+        uint8_t *ptr            = alloc_aligned<uint8_t>(data, buf_sz * STRIPS * 4, OPTIMAL_ALIGN);
+        UTEST_ASSERT(ptr != NULL);
+        for (size_t i=0; i<STRIPS; ++i)
+        {
+            vIn[i]                  = advance_ptr_bytes<float>(ptr, buf_sz);
+            vSc[i]                  = advance_ptr_bytes<float>(ptr, buf_sz);
+            vOut[i]                 = advance_ptr_bytes<float>(ptr, buf_sz);
+            vRef[i]                 = advance_ptr_bytes<float>(ptr, buf_sz);
+        }
+
+        uint32_t seed           = 0x1234;
+        ref_signals(vIn, vSc, STRIPS, SIGNAL_SIZE, seed);
+
+        // Render all strips at once with the batch processor
+        plugins::ringmod_sc_batch batch;
+        UTEST_ASSERT(batch.init(STRIPS));
+        for (size_t i=0; i<STRIPS; ++i)
+        {
+            const strip_params_t *s = &strips[i];
+            plugins::ringmod_sc_batch::strip_t st;
+            st.fInGain              = s->fInGain;
+            st.fScGain              = s->fScGain;
+            st.fTauRelease          = plugins::ringmod_sc_kernels::release_tau(SAMPLE_RATE, s->fRelease);
+            st.nHold                = dspu::millis_to_samples(SAMPLE_RATE, s->fHold);
+            st.fAmount              = dspu::db_to_gain(s->fAmount);
+            st.fDry                 = s->fDry;
+            st.fWet                 = s->fWet;
+            st.bInvert              = s->bInvert;
+            batch.set_strip(i, &st);
+        }
+
+        for (size_t offset=0, k=0; offset < SIGNAL_SIZE; ++k)
+        {
+            const size_t count  = lsp_min(block_sizes[k % (sizeof(block_sizes)/sizeof(block_sizes[0]))], SIGNAL_SIZE - offset);
+            float *out[STRIPS];
+            const float *in[STRIPS], *sc[STRIPS];
+            for (size_t i=0; i<STRIPS; ++i)
+            {
+                out[i]                  = &vOut[i][offset];
+                in[i]                   = &vIn[i][offset];
+                sc[i]                   = &vSc[i][offset];
+            }
+            batch.process(out, in, sc, count);
+            offset     += count;
+        }
+        batch.destroy();
+
+        // Render each strip with the plugin and compare
+        for (size_t i=0; i<STRIPS; ++i)
+        {
+            printf("Testing strip %d...\n", int(i));
+            render_plugin(vRef[i], vIn[i], vSc[i], &strips[i]);
+
+            for (size_t j=0; j<SIGNAL_SIZE; ++j)
+            {
+                const float d = fabsf(vOut[i][j] - vRef[i][j]);
+                UTEST_ASSERT_MSG(d <= TOLERANCE,
+                    "strip %d: sample %d differs: batch=%.9g plugin=%.9g (diff=%.9g)",
+                    int(i), int(j), vOut[i][j], vRef[i][j], d);
+            }
+        }
+
+        free_aligned(data);
+    }
+
+UTEST_END
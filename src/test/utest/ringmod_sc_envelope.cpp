@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-ringmod-sc
+ * Created on: 16 окт 2026 г.
+ *
+ * lsp-plugins-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+
+#include <private/plugins/ringmod_sc_kernels.h>
+
+#include "../helpers/ringmod_sc_ref.h"
+
+// Number of samples processed for each combination of parameters
+#define SIGNAL_SIZE         2048
+
+namespace
+{
+    using namespace lsp;
+    using namespace lsp::plugins;
+    using namespace lsp::ringmod_sc_test;
+
+    // Sizes of the blocks, cycled while processing the signal
+    static const size_t block_sizes[] =
+    {
+        1, 3, 64, 17, 256, 2, 511, 8
+    };
+
+    static const uint32_t holds[] =
+    {
+        0, 1, 7, 480
+    };
+
+    static const float taus[] =
+    {
+        1.0f, 0.5f, 1e-3f, 1e-6f
+    };
+
+    typedef struct gain_t
+    {
+        float               fGain;      // Gain at the first sample of the block
+        float               fDelta;     // Gain increment per sample
+    } gain_t;
+
+    static const gain_t gains[] =
+    {
+        { 1.0f,     0.0f    },
+        { 0.5f,     1e-4f   },
+        { 2.0f,     -1e-4f  },
+        { 0.0f,     0.0f    }
+    };
+}
+
+UTEST_BEGIN("plugins.ringmod_sc", envelope)
+
+    /**
+     * Fill the sidechain signals: noise bursts, silence, constant values and denormals,
+     * so every branch of the follower gets exercised
+     */
+    void make_signal(float *s0, float *s1, uint32_t & seed)
+    {
+        float *in[1]    = { s0 };
+        float *sc[1]    = { s1 };
+        ref_signals(in, sc, 1, SIGNAL_SIZE, seed);
+
+        for (size_t i=0; i<SIGNAL_SIZE / 8; ++i)
+        {
+            s0[SIGNAL_SIZE / 4 + i]     = 0.0f;
+            s1[SIGNAL_SIZE / 4 + i]     = 0.25f;
+            s0[SIGNAL_SIZE / 2 + i]     = (i & 1) ? 1e-40f : -1e-40f;
+            s1[SIGNAL_SIZE / 2 + i]     = -0.25f;
+        }
+    }
+
+    void test_envelope(const float *s0, const float *s1, uint32_t hold_max, float tau, const gain_t *g)
+    {
+        float d0[SIGNAL_SIZE], d1[SIGNAL_SIZE];
+        float r0[SIGNAL_SIZE], r1[SIGNAL_SIZE];
+
+        float peak[2]       = { 0.0f, 0.0f };
+        uint32_t hold[2]    = { 0, 0 };
+        float rpeak[2]      = { 0.0f, 0.0f };
+        uint32_t rhold[2]   = { 0, 0 };
+
+        for (size_t offset=0, k=0; offset < SIGNAL_SIZE; ++k)
+        {
+            const size_t count  = lsp_min(block_sizes[k % (sizeof(block_sizes)/sizeof(block_sizes[0]))], SIGNAL_SIZE - offset);
+            const float gain    = g->fGain + g->fDelta * offset;
+
+            float *dst[2]       = { &d0[offset], &d1[offset] };
+            const float *src[2] = { &s0[offset], &s1[offset] };
+            ringmod_sc_kernels::envelope_x2(dst, src, gain, g->fDelta, tau, hold_max, peak, hold, count);
+            ringmod_sc_kernels::envelope_x1(&r0[offset], &s0[offset], gain, g->fDelta, tau, hold_max, &rpeak[0], &rhold[0], count);
+            ringmod_sc_kernels::envelope_x1(&r1[offset], &s1[offset], gain, g->fDelta, tau, hold_max, &rpeak[1], &rhold[1], count);
+
+            offset             += count;
+        }
+
+        for (size_t i=0; i<SIGNAL_SIZE; ++i)
+        {
+            UTEST_ASSERT_MSG(d0[i] == r0[i],
+                "hold=%d tau=%g gain=%g: lane 0 sample %d differs: %.9g vs %.9g",
+                int(hold_max), tau, g->fGain, int(i), d0[i], r0[i]);
+            UTEST_ASSERT_MSG(d1[i] == r1[i],
+                "hold=%d tau=%g gain=%g: lane 1 sample %d differs: %.9g vs %.9g",
+                int(hold_max), tau, g->fGain, int(i), d1[i], r1[i]);
+        }
+        for (size_t i=0; i<2; ++i)
+        {
+            UTEST_ASSERT_MSG((peak[i] == rpeak[i]) && (hold[i] == rhold[i]),
+                "hold=%d tau=%g gain=%g: state of lane %d differs: peak %.9g vs %.9g, hold %d vs %d",
+                int(hold_max), tau, g->fGain, int(i), peak[i], rpeak[i], int(hold[i]), int(rhold[i]));
+        }
+    }
+
+    UTEST_MAIN
+    {
+        float s0[SIGNAL_SIZE], s1[SIGNAL_SIZE];
+        uint32_t seed   = 0x1234;
+
+        make_signal(s0, s1, seed);
+
+        for (size_t i=0; i<sizeof(holds)/sizeof(holds[0]); ++i)
+            for (size_t j=0; j<sizeof(taus)/sizeof(taus[0]); ++j)
+                for (size_t k=0; k<sizeof(gains)/sizeof(gains[0]); ++k)
+                {
+                    printf("Testing hold=%d tau=%g gain=%g dgain=%g...\n",
+                        int(holds[i]), taus[j], gains[k].fGain, gains[k].fDelta);
+                    test_envelope(s0, s1, holds[i], taus[j], &gains[k]);
+                }
+    }
+
+UTEST_END
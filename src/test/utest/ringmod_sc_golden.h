@@ -0,0 +1,537 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-ringmod-sc
+ * Created on: 16 окт 2026 г.
+ *
+ * lsp-plugins-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_UTEST_RINGMOD_SC_GOLDEN_H_
+#define TEST_UTEST_RINGMOD_SC_GOLDEN_H_
+
+#include "../helpers/ringmod_sc_ref.h"
+
+namespace lsp
+{
+    namespace ringmod_sc_test
+    {
+        /**
+         * Golden output of the scalar reference implementation. The signals are produced by
+         * ref_signals() with GOLDEN_SEED, a fresh generator state for each block of data.
+         * Settings: external sidechain, output of the input signal enabled, output of the
+         * sidechain signal disabled, sidechain processing active.
+         */
+        static constexpr size_t     GOLDEN_SAMPLES      = 64;
+        static constexpr uint32_t   GOLDEN_SEED         = 0x5eed;
+        static constexpr float      GOLDEN_SAMPLE_RATE  = 48000.0f;
+        static constexpr float      GOLDEN_HOLD         = 0.1f;
+        static constexpr float      GOLDEN_RELEASE      = 1.0f;
+        static constexpr float      GOLDEN_STEREO_LINK  = 50.0f;
+
+        // Mono, indexed by: invert
+        static const float golden_mono[2][GOLDEN_SAMPLES] =
+        {
+            {
+                0.113826349f, -0.0214393288f, 0.210221693f, -0.150568902f, -0.161689743f, 0.123314567f, 0.240286067f, -0.221331924f,
+                0.156054556f, 0.0745758563f, 0.156976938f, -0.0800658688f, -0.104093343f, -0.2891967f, 0.043632146f, -0.244820982f,
+                0.00506095123f, 0.121075436f, -0.139619157f, -0.126079232f, 0.0841869041f, 0.226874977f, 0.149622276f, 0.240854308f,
+                0.268811762f, 0.149311304f, -0.18877624f, -0.136325702f, 0.136134207f, -0.0449147224f, 0.146282315f, 0.108989112f,
+                0.238694742f, -0.0753047392f, 0.0318845212f, -0.062750861f, -0.119505003f, 0.0537639856f, -0.159101158f, -0.186229303f,
+                0.111049809f, 0.20947744f, -0.213461787f, 0.245546684f, -0.135161027f, 0.0024968232f, -0.0885984004f, -0.00788527727f,
+                0.138735339f, -0.173541382f, 0.122622639f, 0.172336489f, 0.0778132379f, -0.292987466f, -0.0184972845f, 0.225700483f,
+                -0.288906395f, -0.155782372f, -0.220925257f, -0.13441132f, 0.290905863f, 0.114481978f, 0.00481555425f, -0.0671578422f
+            },
+            {
+                0.0401531309f, -0.00779657066f, 0.205038145f, -0.146856248f, -0.157702878f, 0.12027394f, 0.234361216f, -0.205508158f,
+                0.138180673f, 0.0630634278f, 0.126728937f, -0.0618313402f, -0.0771384016f, -0.205639496f, 0.0297541656f, -0.160383657f,
+                0.00318457652f, 0.07337071f, -0.081407547f, -0.070773989f, 0.0454777554f, 0.118403062f, 0.0753392354f, 0.116860405f,
+                0.125627443f, 0.0673453882f, -0.0823476538f, -0.0575483069f, 0.0554799996f, -0.0177512802f, 0.0558815636f, 0.0404217355f,
+                0.0872694552f, -0.104852505f, 0.0443952382f, -0.0873727947f, -0.166395888f, 0.0748596787f, -0.208805412f, -0.231626257f,
+                0.130653471f, 0.233402237f, -0.225796729f, 0.247431472f, -0.129807249f, 0.00228442322f, -0.0773518384f, -0.00659215404f,
+                0.11105451f, -0.132809743f, 0.0900284424f, 0.121248104f, 0.05270705f, -0.190276146f, -0.0115796961f, 0.135876089f,
+                -0.167470321f, -0.0869761333f, -0.119203292f, -0.0698390827f, 0.146228403f, 0.0556853525f, 0.00226851762f, -0.0305019207f
+            }
+        };
+
+        // Stereo, indexed by: sidechain source, invert, channel
+        static const float golden_stereo[REF_SRC_TOTAL][2][2][GOLDEN_SAMPLES] =
+        {
+            {
+                {
+                    {
+                        0.127326757f, -0.0169419311f, 0.0793851614f, -0.0568587221f, -0.0610582419f, 0.015322024f, 0.0298559107f, -0.0268487781f,
+                        0.0185077656f, 0.00865768455f, 0.0243128091f, -0.0154211354f, -0.02371707f, -0.0750230104f, 0.0126912855f, -0.0785113573f,
+                        0.00176359236f, 0.0453714095f, -0.0558251478f, -0.053213127f, 0.0373460017f, 0.105263889f, 0.0724853501f, 0.121043094f,
+                        0.139861897f, 0.0801994428f, -0.104633503f, -0.0777715743f, 0.0796754211f, -0.026922347f, 0.0896450579f, 0.0489434674f,
+                        0.108172603f, -0.000193974993f, 8.21302892e-05f, -0.000161637887f, -0.000307829003f, 0.000138488875f, -0.00944286492f, -0.0208771173f,
+                        0.0178334732f, 0.0426325016f, -0.0522387289f, 0.0693322793f, -0.0428135023f, 0.000869441486f, -0.0334940068f, -0.00320917391f,
+                        0.0600261949f, -0.0791416019f, 0.0588452965f, 0.0864950791f, 0.0407606699f, -0.159071967f, -0.0103873871f, 0.130549312f,
+                        -0.171933025f, -0.0952147022f, -0.138434082f, -0.0442327112f, 0.0978315398f, 0.0391908661f, 0.0016785668f, -0.023786556f
+                    },
+                    {
+                        0.0888915211f, -0.0840871781f, 0.10775461f, 0.0341563001f, -0.0058179372f, -0.0836648643f, 0.187323436f, 0.0267925225f,
+                        -0.0494663529f, -0.0639310107f, -0.0135950418f, -0.0562087037f, 0.153219208f, 0.121702939f, 0.0677137896f, 0.113248363f,
+                        -0.0783891827f, -0.171543971f, 0.104101278f, 0.106403977f, 0.0608810484f, -0.225784585f, 0.140694797f, -0.0553355291f,
+                        -0.0140818348f, 0.0901029408f, 0.174764007f, -0.154949844f, -0.0412078984f, -0.188721001f, -0.055890426f, 0.0867546424f,
+                        0.0157738887f, -0.0290006865f, -0.0113932071f, 0.0286268014f, -0.0131243104f, 0.0103108417f, -0.0135939149f, 0.0706890523f,
+                        0.0168138109f, 0.0088503398f, 0.0299477894f, -0.0813655555f, 0.0679477677f, -0.0290086567f, -0.0459719114f, -0.123196393f,
+                        -0.0978609174f, 0.0216926355f, -0.113015994f, 0.0481920429f, -0.195947945f, -0.0174899157f, -0.202695057f, 0.0878852159f,
+                        0.117241904f, -0.108789682f, 0.231623679f, 0.00141371903f, -0.00548633654f, -0.00525470078f, -0.00562468171f, 0.000846311217f
+                    }
+                },
+                {
+                    {
+                        0.0266527273f, -0.0122939683f, 0.335874677f, -0.240566432f, -0.258334368f, 0.228266478f, 0.444791377f, -0.399991304f,
+                        0.275727451f, 0.128981605f, 0.259393066f, -0.126476064f, -0.157514662f, -0.419813186f, 0.0606950261f, -0.326693296f,
+                        0.00648193527f, 0.149074733f, -0.165201575f, -0.143640086f, 0.0923186615f, 0.240014136f, 0.152476162f, 0.236671627f,
+                        0.254577309f, 0.136457235f, -0.166490391f, -0.116102427f, 0.111938789f, -0.03574365f, 0.112518817f, 0.100467376f,
+                        0.217791617f, -0.179963276f, 0.0761976317f, -0.149962023f, -0.285593063f, 0.128485173f, -0.358463705f, -0.396978438f,
+                        0.223869801f, 0.400247186f, -0.387019783f, 0.423645884f, -0.222154781f, 0.00391180487f, -0.132456228f, -0.0112682581f,
+                        0.189763635f, -0.227209523f, 0.153805777f, 0.207089514f, 0.0897596106f, -0.32419166f, -0.0196895935f, 0.231027246f,
+                        -0.284443706f, -0.147543803f, -0.201694459f, -0.160017684f, 0.339302719f, 0.130976468f, 0.00540550472f, -0.0738732144f
+                    },
+                    {
+                        0.0414931625f, -0.0492518097f, 0.139124736f, 0.0441000685f, -0.00751168793f, -0.138881356f, 0.306452096f, 0.0431352891f,
+                        -0.0784809142f, -0.100042082f, -0.0199991483f, -0.077846311f, 0.200198725f, 0.15042749f, 0.0792884901f, 0.125864014f,
+                        -0.0826920122f, -0.17217879f, 0.0994756445f, 0.0971368924f, 0.0530435145f, -0.188375592f, 0.112226963f, -0.0422606394f,
+                        -0.0103150019f, 0.063269347f, 0.11779055f, -0.15306735f, -0.0395302884f, -0.223493516f, -0.0643744022f, 0.350872189f,
+                        0.0637962297f, -0.262002051f, -0.102930114f, 0.258624256f, -0.107084908f, 0.0763743371f, -0.0833285451f, 0.367310256f,
+                        0.075330019f, 0.0349152051f, 0.105150431f, -0.256938785f, 0.194480047f, -0.0757674277f, -0.110119298f, -0.272093326f,
+                        -0.200114921f, 0.0412294827f, -0.200052395f, 0.0796722025f, -0.303642213f, -0.0255029742f, -0.278400809f, 0.114112958f,
+                        0.144059971f, -0.126664162f, 0.256263763f, 0.123416647f, -0.478953212f, -0.458731592f, -0.491030663f, 0.0738823563f
+                    }
+                }
+            },
+            {
+                {
+                    {
+                        0.104977593f, -0.0184369497f, 0.181247085f, -0.129816175f, -0.139404237f, 0.0915755853f, 0.180066764f, -0.163541824f,
+                        0.1137558f, 0.0536637977f, 0.114811324f, -0.0594968982f, -0.0785703808f, -0.221302047f, 0.0338040031f, -0.191912949f,
+                        0.00401263591f, 0.0970435143f, -0.113024421f, -0.102907911f, 0.069292523f, 0.188232616f, 0.125141129f, 0.202818751f,
+                        0.227670014f, 0.127281174f, -0.161961913f, -0.0975294411f, 0.0977978259f, -0.028689893f, 0.0939512029f, 0.0296190344f,
+                        0.0646187738f, -0.0179540701f, 0.00760187116f, -0.0149609894f, -0.0312143452f, 0.0152992494f, -0.0516009443f, -0.0674380362f,
+                        0.0441044532f, 0.0895598531f, -0.0973722786f, 0.118566141f, -0.0686055422f, 0.00132375176f, -0.0488755889f, -0.00451205112f,
+                        0.0820357203f, -0.105615698f, 0.0767658874f, 0.110652052f, 0.0511923246f, -0.196596235f, -0.0126720183f, 0.157314464f,
+                        -0.204768822f, -0.112164751f, -0.161475405f, -0.00231316034f, 0.00495059835f, 0.00192716555f, 8.02279683e-05f, -0.00110600865f
+                    },
+                    {
+                        0.107816041f, -0.0772686973f, 0.0471958891f, 0.0149602592f, -0.00254822243f, -0.0139984377f, 0.0310591031f, 0.00439854758f,
+                        -0.00804804452f, -0.0103141135f, -0.00287892926f, -0.0145688606f, 0.046250388f, 0.0412581861f, 0.0254222881f, 0.0463297665f,
+                        -0.0344528034f, -0.0802031085f, 0.0514178202f, 0.0550209209f, 0.0328125395f, -0.126263782f, 0.0814944804f, -0.0330244787f,
+                        -0.00865073223f, 0.056773562f, 0.112904131f, -0.123559535f, -0.0335718803f, -0.177094162f, -0.0533287525f, 0.143356219f,
+                        0.0264056791f, -0.000313322176f, -0.000123091726f, 0.00030928271f, -0.000129429056f, 9.33337869e-05f, -0.00248765782f, 0.0218835492f,
+                        0.00679860264f, 0.0042129606f, 0.0160665289f, -0.0475790091f, 0.0424030125f, -0.0190529153f, -0.0315041468f, -0.0876228213f,
+                        -0.0716056153f, 0.0162550639f, -0.0866330117f, 0.0376710109f, -0.156018898f, -0.0141516207f, -0.166151285f, 0.0729326084f,
+                        0.0984415263f, -0.0923496708f, 0.198572725f, 0.0270334128f, -0.108418554f, -0.106859669f, -0.117682211f, 0.0182013307f
+                    }
+                },
+                {
+                    {
+                        0.0490018874f, -0.0107989488f, 0.234012753f, -0.167608976f, -0.179988384f, 0.152012929f, 0.294580519f, -0.263298243f,
+                        0.180479437f, 0.0839754865f, 0.168894574f, -0.0824002996f, -0.102661356f, -0.273534149f, 0.0395823084f, -0.213291705f,
+                        0.00423289184f, 0.0974026322f, -0.108002298f, -0.093945317f, 0.0603721365f, 0.157045409f, 0.0998203903f, 0.154895961f,
+                        0.166769207f, 0.0893755183f, -0.109161973f, -0.0963445529f, 0.0938163847f, -0.0339761041f, 0.108212672f, 0.119791813f,
+                        0.261345446f, -0.162203178f, 0.0686778873f, -0.135162666f, -0.254686534f, 0.113324419f, -0.316305637f, -0.350417525f,
+                        0.197598815f, 0.353319824f, -0.341886222f, 0.37441203f, -0.196362734f, 0.00345749431f, -0.117074654f, -0.00996538065f,
+                        0.167754114f, -0.200735435f, 0.135885194f, 0.182932526f, 0.0793279558f, -0.286667377f, -0.0174049623f, 0.204262093f,
+                        -0.251607925f, -0.130593762f, -0.178653136f, -0.201937228f, 0.432183653f, 0.16824016f, 0.00700384378f, -0.0965537578f
+                    },
+                    {
+                        0.0225686394f, -0.0560702905f, 0.199683458f, 0.0632961094f, -0.0107814027f, -0.208547786f, 0.46271643f, 0.0655292645f,
+                        -0.119899228f, -0.153658986f, -0.0307152625f, -0.119486161f, 0.30716753f, 0.230872244f, 0.12157999f, 0.192782611f,
+                        -0.126628384f, -0.263519645f, 0.15215911f, 0.148519933f, 0.0811120197f, -0.287896395f, 0.17142728f, -0.0645716861f,
+                        -0.0157461055f, 0.096598722f, 0.179650426f, -0.18445766f, -0.0471663065f, -0.235120356f, -0.0669360757f, 0.294270605f,
+                        0.0531644374f, -0.290689439f, -0.114200227f, 0.286941767f, -0.120079786f, 0.0865918472f, -0.0944347978f, 0.416115761f,
+                        0.085345231f, 0.0395525843f, 0.11903169f, -0.290725321f, 0.220024794f, -0.0857231691f, -0.124587066f, -0.307666898f,
+                        -0.226370215f, 0.0466670543f, -0.226435378f, 0.0901932344f, -0.343571275f, -0.0288412701f, -0.314944565f, 0.129065558f,
+                        0.162860349f, -0.143104181f, 0.289314717f, 0.0977969542f, -0.376020998f, -0.357126623f, -0.378973126f, 0.0565273389f
+                    }
+                }
+            },
+            {
+                {
+                    {
+                        0.149675906f, -0.0169419311f, 0.0793851614f, -0.0568587221f, -0.0610582419f, 0.015322024f, 0.0298559107f, -0.0268487781f,
+                        0.0185077656f, 0.00865768455f, 0.0243128091f, -0.0154211354f, -0.02371707f, -0.0750230104f, 0.0126912855f, -0.0785113573f,
+                        0.00176359236f, 0.0453714095f, -0.0558251478f, -0.053213127f, 0.0373460017f, 0.105263889f, 0.0724853501f, 0.121043094f,
+                        0.139861897f, 0.0801994428f, -0.104633503f, -0.0777715743f, 0.0796754211f, -0.026922347f, 0.0896450579f, 0.0682678968f,
+                        0.15172641f, -0.000193974993f, 8.21302892e-05f, -0.000161637887f, -0.000307829003f, 0.000138488875f, -0.00944286492f, -0.0208771173f,
+                        0.0178334732f, 0.0426325016f, -0.0522387289f, 0.0693322793f, -0.0428135023f, 0.000869441486f, -0.0334940068f, -0.00320917391f,
+                        0.0600261949f, -0.0791416019f, 0.0588452965f, 0.0864950791f, 0.0407606699f, -0.159071967f, -0.0103873871f, 0.130549312f,
+                        -0.171933025f, -0.0952147022f, -0.138434082f, -0.0861522481f, 0.190712467f, 0.0764545575f, 0.00327690528f, -0.0464671068f
+                    },
+                    {
+                        0.12674056f, -0.0772686973f, 0.0471958891f, 0.0149602592f, -0.00254822243f, -0.0139984377f, 0.0310591031f, 0.00439854758f,
+                        -0.00804804452f, -0.0103141135f, -0.00287892926f, -0.0145688606f, 0.046250388f, 0.0412581861f, 0.0254222881f, 0.0463297665f,
+                        -0.0344528034f, -0.0802031085f, 0.0514178202f, 0.0550209209f, 0.0328125395f, -0.126263782f, 0.0814944804f, -0.0330244787f,
+                        -0.00865073223f, 0.056773562f, 0.112904131f, -0.123559535f, -0.0335718803f, -0.177094162f, -0.0533287525f, 0.199957803f,
+                        0.0370374657f, -0.000313322176f, -0.000123091726f, 0.00030928271f, -0.000129429056f, 9.33337869e-05f, -0.00248765782f, 0.0218835492f,
+                        0.00679860264f, 0.0042129606f, 0.0160665289f, -0.0475790091f, 0.0424030125f, -0.0190529153f, -0.0315041468f, -0.0876228213f,
+                        -0.0716056153f, 0.0162550639f, -0.0866330117f, 0.0376710109f, -0.156018898f, -0.0141516207f, -0.166151285f, 0.0729326084f,
+                        0.0984415263f, -0.0923496708f, 0.198572725f, 0.0526531003f, -0.211350769f, -0.208464608f, -0.229739711f, 0.0355563536f
+                    }
+                },
+                {
+                    {
+                        0.00430356851f, -0.0122939683f, 0.335874677f, -0.240566432f, -0.258334368f, 0.228266478f, 0.444791377f, -0.399991304f,
+                        0.275727451f, 0.128981605f, 0.259393066f, -0.126476064f, -0.157514662f, -0.419813186f, 0.0606950261f, -0.326693296f,
+                        0.00648193527f, 0.149074733f, -0.165201575f, -0.143640086f, 0.0923186615f, 0.240014136f, 0.152476162f, 0.236671627f,
+                        0.254577309f, 0.136457235f, -0.166490391f, -0.116102427f, 0.111938789f, -0.03574365f, 0.112518817f, 0.0811429471f,
+                        0.174237803f, -0.179963276f, 0.0761976317f, -0.149962023f, -0.285593063f, 0.128485173f, -0.358463705f, -0.396978438f,
+                        0.223869801f, 0.400247186f, -0.387019783f, 0.423645884f, -0.222154781f, 0.00391180487f, -0.132456228f, -0.0112682581f,
+                        0.189763635f, -0.227209523f, 0.153805777f, 0.207089514f, 0.0897596106f, -0.32419166f, -0.0196895935f, 0.231027246f,
+                        -0.284443706f, -0.147543803f, -0.201694459f, -0.118098147f, 0.246421799f, 0.0937127694f, 0.00380716636f, -0.0511926599f
+                    },
+                    {
+                        0.00364411832f, -0.0560702905f, 0.199683458f, 0.0632961094f, -0.0107814027f, -0.208547786f, 0.46271643f, 0.0655292645f,
+                        -0.119899228f, -0.153658986f, -0.0307152625f, -0.119486161f, 0.30716753f, 0.230872244f, 0.12157999f, 0.192782611f,
+                        -0.126628384f, -0.263519645f, 0.15215911f, 0.148519933f, 0.0811120197f, -0.287896395f, 0.17142728f, -0.0645716861f,
+                        -0.0157461055f, 0.096598722f, 0.179650426f, -0.18445766f, -0.0471663065f, -0.235120356f, -0.0669360757f, 0.237669036f,
+                        0.0425326489f, -0.290689439f, -0.114200227f, 0.286941767f, -0.120079786f, 0.0865918472f, -0.0944347978f, 0.416115761f,
+                        0.085345231f, 0.0395525843f, 0.11903169f, -0.290725321f, 0.220024794f, -0.0857231691f, -0.124587066f, -0.307666898f,
+                        -0.226370215f, 0.0466670543f, -0.226435378f, 0.0901932344f, -0.343571275f, -0.0288412701f, -0.314944565f, 0.129065558f,
+                        0.162860349f, -0.143104181f, 0.289314717f, 0.0721772611f, -0.273088783f, -0.255521685f, -0.266915649f, 0.0391723141f
+                    }
+                }
+            },
+            {
+                {
+                    {
+                        0.104977593f, -0.0199319702f, 0.283109009f, -0.202773616f, -0.217750236f, 0.167829111f, 0.330277592f, -0.300234854f,
+                        0.209003836f, 0.0986699089f, 0.205309808f, -0.103572659f, -0.133423701f, -0.36758104f, 0.0549167134f, -0.305314511f,
+                        0.00626167981f, 0.1487156f, -0.170223683f, -0.152602687f, 0.10123904f, 0.271201342f, 0.1777969f, 0.284594446f,
+                        0.315478116f, 0.174362898f, -0.219290316f, -0.117287323f, 0.115920231f, -0.0304574426f, 0.0982573405f, 0.0296190344f,
+                        0.0646187738f, -0.0357141644f, 0.0151216118f, -0.0297603402f, -0.0621208437f, 0.0304600019f, -0.0937590525f, -0.113998979f,
+                        0.0703754425f, 0.136487171f, -0.142505839f, 0.167799994f, -0.094397597f, 0.00177806173f, -0.0642571673f, -0.00581492716f,
+                        0.104045227f, -0.132089809f, 0.094686456f, 0.134809032f, 0.0616239794f, -0.234120503f, -0.0149566503f, 0.184079647f,
+                        -0.237604618f, -0.129114807f, -0.184516743f, -0.00231316034f, 0.00495059835f, 0.00192716555f, 8.02279683e-05f, -0.00110600865f
+                    },
+                    {
+                        0.0888915211f, -0.0909056589f, 0.168313324f, 0.0533523373f, -0.00908765197f, -0.153331265f, 0.343587786f, 0.0491864942f,
+                        -0.0908846632f, -0.117547914f, -0.0243111532f, -0.0978485495f, 0.260188013f, 0.202147663f, 0.110005289f, 0.18016693f,
+                        -0.122325569f, -0.262884796f, 0.156784728f, 0.15778701f, 0.0889495537f, -0.325305402f, 0.199895084f, -0.0776465833f,
+                        -0.0195129383f, 0.123432316f, 0.236623853f, -0.186340168f, -0.0488439202f, -0.200347871f, -0.0584520958f, 0.0867546424f,
+                        0.0157738887f, -0.05768805f, -0.0226633232f, 0.0569443181f, -0.0261191837f, 0.0205283444f, -0.0247001778f, 0.11949458f,
+                        0.0268290266f, 0.0134877171f, 0.0438290536f, -0.115152098f, 0.0934925303f, -0.0389643908f, -0.0604396798f, -0.158769935f,
+                        -0.124116197f, 0.0271302126f, -0.139398962f, 0.0587130748f, -0.235877007f, -0.0208282117f, -0.239238858f, 0.102837838f,
+                        0.136042282f, -0.125229701f, 0.264674634f, 0.00141371903f, -0.00548633654f, -0.00525470078f, -0.00562468171f, 0.000846311217f
+                    }
+                },
+                {
+                    {
+                        0.0490018874f, -0.00930392928f, 0.132150829f, -0.0946515277f, -0.101642378f, 0.0757593811f, 0.144369692f, -0.126605213f,
+                        0.0852314085f, 0.0389693715f, 0.0783960819f, -0.0383245423f, -0.0478080399f, -0.127255172f, 0.0184696f, -0.0998901352f,
+                        0.00198384793f, 0.0457305424f, -0.0508030318f, -0.0442505442f, 0.0284256209f, 0.0740766674f, 0.0471646227f, 0.0731202886f,
+                        0.0789610893f, 0.0422937907f, -0.05183357f, -0.0765866786f, 0.0756939799f, -0.0322085582f, 0.103906535f, 0.119791813f,
+                        0.261345446f, -0.14444308f, 0.0611581467f, -0.120363317f, -0.223780051f, 0.0981636643f, -0.274147511f, -0.303856581f,
+                        0.171327829f, 0.306392491f, -0.296752691f, 0.325178146f, -0.170570672f, 0.00300318445f, -0.101693071f, -0.00866250508f,
+                        0.145744607f, -0.174261317f, 0.117964618f, 0.158775553f, 0.0688963011f, -0.249143109f, -0.0151203303f, 0.177496925f,
+                        -0.218772128f, -0.113643713f, -0.155611813f, -0.201937228f, 0.432183653f, 0.16824016f, 0.00700384378f, -0.0965537578f
+                    },
+                    {
+                        0.0414931625f, -0.0424333289f, 0.0785660073f, 0.0249040313f, -0.0042419727f, -0.0692149401f, 0.15018779f, 0.0207413174f,
+                        -0.0370626114f, -0.0464251786f, -0.00928303972f, -0.0362064727f, 0.0932299122f, 0.0699827597f, 0.0369969979f, 0.0589454435f,
+                        -0.0387556292f, -0.0808379501f, 0.0467921942f, 0.0457538553f, 0.024975013f, -0.0888547972f, 0.053026665f, -0.0199495852f,
+                        -0.00488389796f, 0.0299399756f, 0.0559306964f, -0.121677034f, -0.0318942666f, -0.211866647f, -0.0618127324f, 0.350872189f,
+                        0.0637962297f, -0.233314693f, -0.0916599929f, 0.23030673f, -0.0940900296f, 0.0661568344f, -0.0722222775f, 0.318504721f,
+                        0.065314807f, 0.0302778278f, 0.0912691653f, -0.22315225f, 0.168935269f, -0.0658116937f, -0.0956515297f, -0.236519784f,
+                        -0.173859641f, 0.0357919075f, -0.173669428f, 0.0691511631f, -0.263713151f, -0.0221646782f, -0.241856992f, 0.0991603434f,
+                        0.125259608f, -0.110224143f, 0.223212808f, 0.123416647f, -0.478953212f, -0.458731592f, -0.491030663f, 0.0738823563f
+                    }
+                }
+            },
+            {
+                {
+                    {
+                        0.129478544f, -0.0230889153f, 0.2473225f, -0.177141935f, -0.190225437f, 0.129455268f, 0.252251595f, -0.226844415f,
+                        0.156371504f, 0.0731484815f, 0.154009342f, -0.0786148161f, -0.102400601f, -0.284733176f, 0.0429772511f, -0.241298288f,
+                        0.00499317329f, 0.119621746f, -0.138055086f, -0.12471123f, 0.083298631f, 0.224734426f, 0.148346618f, 0.238794848f,
+                        0.266437352f, 0.14804621f, -0.187311441f, -0.134488344f, 0.134098276f, -0.0439241827f, 0.141998693f, 0.089514941f,
+                        0.195291489f, -0.0875996947f, 0.0370902866f, -0.0729961544f, -0.139016509f, 0.0625419989f, -0.1833179f, -0.213390008f,
+                        0.12640135f, 0.236938864f, -0.239854231f, 0.274434209f, -0.150469095f, 0.00276668067f, -0.0977822393f, -0.00867088325f,
+                        0.151978746f, -0.189229682f, 0.133339867f, 0.186812863f, 0.0842145532f, -0.315775901f, -0.0199080873f, 0.242410541f,
+                        -0.309672594f, -0.166618809f, -0.236036301f, -0.102531016f, 0.219435662f, 0.0854217634f, 0.0035561109f, -0.0490239188f
+                    },
+                    {
+                        0.107816041f, -0.105112314f, 0.146967411f, 0.046586059f, -0.00793513283f, -0.11468073f, 0.254448444f, 0.0360346362f,
+                        -0.0659327582f, -0.0844972953f, -0.0177140199f, -0.0722300261f, 0.194390416f, 0.152613133f, 0.0840044692f, 0.139077306f,
+                        -0.0953878164f, -0.206900284f, 0.124539107f, 0.126322061f, 0.0717478842f, -0.264646113f, 0.163827553f, -0.0640411675f,
+                        -0.0162030812f, 0.103113994f, 0.198999748f, -0.2104242f, -0.0556559898f, -0.284910321f, -0.0833655149f, 0.25723961f,
+                        0.0467717797f, -0.145658031f, -0.0572232045f, 0.143780172f, -0.0601693243f, 0.043389257f, -0.0496756993f, 0.229695365f,
+                        0.0494207591f, 0.0239658933f, 0.0754399598f, -0.192498013f, 0.152077943f, -0.0617831647f, -0.0936069638f, -0.240845904f,
+                        -0.18434225f, 0.0394962803f, -0.199403003f, 0.0825893879f, -0.326985359f, -0.0284924805f, -0.3227534f, 0.137105748f,
+                        0.179364681f, -0.163383693f, 0.342029482f, 0.0631220415f, -0.244962946f, -0.234620482f, -0.251140028f, 0.0377874896f
+                    }
+                },
+                {
+                    {
+                        0.0245009437f, -0.00614698417f, 0.167937338f, -0.120283216f, -0.129167184f, 0.114133239f, 0.222395688f, -0.199995652f,
+                        0.137863725f, 0.0644908026f, 0.129696533f, -0.0632823855f, -0.0788311362f, -0.210103035f, 0.0304090604f, -0.163906366f,
+                        0.00325235468f, 0.0748244002f, -0.082971625f, -0.0721419901f, 0.0463660322f, 0.120543584f, 0.0766149014f, 0.118919857f,
+                        0.128001854f, 0.0686104819f, -0.083812438f, -0.059385661f, 0.0575159378f, -0.0187418163f, 0.0601651818f, 0.0598959066f,
+                        0.130672723f, -0.0925575495f, 0.0391894728f, -0.0771275014f, -0.146884382f, 0.0660816655f, -0.184588671f, -0.204465553f,
+                        0.115301922f, 0.205940813f, -0.199404284f, 0.218543947f, -0.114499196f, 0.00201456551f, -0.0681679994f, -0.00580654899f,
+                        0.097811088f, -0.117121428f, 0.0793111995f, 0.106771708f, 0.0463057309f, -0.167487696f, -0.0101688942f, 0.119166024f,
+                        -0.146704167f, -0.0761397034f, -0.104092248f, -0.101719372f, 0.217698589f, 0.0847455561f, 0.00352796051f, -0.0486358441f
+                    },
+                    {
+                        0.0225686394f, -0.0282266773f, 0.0999119282f, 0.0316703096f, -0.00539449183f, -0.107865483f, 0.239327088f, 0.0338931717f,
+                        -0.062014509f, -0.0794757903f, -0.0158801712f, -0.061824996f, 0.159027517f, 0.119517289f, 0.062997818f, 0.100035064f,
+                        -0.0656933859f, -0.136822492f, 0.0790378079f, 0.0772188008f, 0.0421766788f, -0.149514064f, 0.0890941992f, -0.033555001f,
+                        -0.00819375459f, 0.0502582975f, 0.0935547948f, -0.097593002f, -0.025082197f, -0.127304196f, -0.0368993096f, 0.180387214f,
+                        0.032798335f, -0.145344719f, -0.0571001135f, 0.143470883f, -0.0600398928f, 0.0432959236f, -0.0472467542f, 0.208303943f,
+                        0.0427230746f, 0.0197996516f, 0.0596582592f, -0.145806327f, 0.110349864f, -0.0429929197f, -0.0624842457f, -0.154443815f,
+                        -0.113633595f, 0.0234258398f, -0.113665387f, 0.04527485f, -0.172604799f, -0.0145004103f, -0.158342451f, 0.0648924261f,
+                        0.0819372013f, -0.072070159f, 0.145857975f, 0.0617083237f, -0.239476606f, -0.229365796f, -0.245515332f, 0.0369411781f
+                    }
+                }
+            },
+            {
+                {
+                    {
+                        0.127326757f, -0.0230469201f, 0.247204408f, -0.177057356f, -0.1901346f, 0.125524074f, 0.244591415f, -0.219955787f,
+                        0.151622936f, 0.0709271654f, 0.149596453f, -0.0764554664f, -0.0996828675f, -0.277508497f, 0.0419366173f, -0.235683218f,
+                        0.00488277292f, 0.117044806f, -0.135214105f, -0.122171566f, 0.0816607475f, 0.22063078f, 0.145716593f, 0.234727129f,
+                        0.261965573f, 0.145660847f, -0.184422314f, -0.132446438f, 0.132087171f, -0.0433128625f, 0.140136525f, 0.0878245682f,
+                        0.191603675f, -0.0901756063f, 0.0381809436f, -0.0751426443f, -0.14310436f, 0.0643810779f, -0.188563272f, -0.219131604f,
+                        0.129636005f, 0.242519706f, -0.245285586f, 0.280508727f, -0.153550148f, 0.00281935069f, -0.0995193645f, -0.00882094819f,
+                        0.15453206f, -0.192296922f, 0.13544409f, 0.189630598f, 0.0854264647f, -0.320271075f, -0.0201777834f, 0.245419174f,
+                        -0.313269347f, -0.168452471f, -0.238444313f, -0.103281781f, 0.221042439f, 0.0860472471f, 0.00358214974f, -0.0493828878f
+                    },
+                    {
+                        0.109638102f, -0.105303846f, 0.14703761f, 0.0466083139f, -0.00793892425f, -0.118272327f, 0.262417316f, 0.0371631794f,
+                        -0.0679976568f, -0.0871436f, -0.0182365589f, -0.0742700398f, 0.199690238f, 0.156586275f, 0.0860890001f, 0.142390773f,
+                        -0.0975445509f, -0.211455554f, 0.127155811f, 0.128948003f, 0.0731869414f, -0.269568443f, 0.16678448f, -0.0651509762f,
+                        -0.016479671f, 0.104802608f, 0.202117249f, -0.213668272f, -0.0565033853f, -0.288931578f, -0.084473297f, 0.262190729f,
+                        0.0476719998f, -0.141497239f, -0.0555885956f, 0.13967301f, -0.0584505536f, 0.0421498194f, -0.0482938401f, 0.223676994f,
+                        0.0481876172f, 0.023414392f, 0.0737694949f, -0.188329399f, 0.149026424f, -0.0606289543f, -0.0919730365f, -0.236748546f,
+                        -0.181296378f, 0.0388662964f, -0.196305141f, 0.0813621953f, -0.322346538f, -0.0280925743f, -0.318439484f, 0.135424957f,
+                        0.177305326f, -0.161605209f, 0.338575363f, 0.062663205f, -0.243182287f, -0.232915014f, -0.249314457f, 0.037512809f
+                    }
+                },
+                {
+                    {
+                        0.0266527273f, -0.00618897984f, 0.16805543f, -0.120367795f, -0.129258022f, 0.118064433f, 0.230055854f, -0.206884265f,
+                        0.142612293f, 0.0667121112f, 0.134109437f, -0.0654417425f, -0.0815488696f, -0.217327699f, 0.0314496979f, -0.169521436f,
+                        0.00336275506f, 0.0774013475f, -0.0858126134f, -0.074681662f, 0.0480039082f, 0.12464723f, 0.0792449266f, 0.122987591f,
+                        0.132473662f, 0.0709958524f, -0.0867015719f, -0.0614275634f, 0.0595270433f, -0.0193531383f, 0.0620273426f, 0.061586272f,
+                        0.134360537f, -0.0899816379f, 0.0380988158f, -0.0749810115f, -0.142796531f, 0.0642425865f, -0.179343283f, -0.198723957f,
+                        0.11206726f, 0.200359985f, -0.19397293f, 0.212469444f, -0.111418121f, 0.0019618955f, -0.0664308742f, -0.00565648358f,
+                        0.0952577814f, -0.114054203f, 0.0772069842f, 0.103953995f, 0.0450938158f, -0.162992552f, -0.00989919715f, 0.116157383f,
+                        -0.143107399f, -0.0743060485f, -0.101684228f, -0.100968614f, 0.216091827f, 0.0841200799f, 0.00350192189f, -0.0482768789f
+                    },
+                    {
+                        0.0207465813f, -0.0280351453f, 0.0998417288f, 0.0316480547f, -0.00539070135f, -0.104273893f, 0.231358215f, 0.0327646323f,
+                        -0.0599496141f, -0.076829493f, -0.0153576313f, -0.0597849786f, 0.153727695f, 0.115544148f, 0.0609132834f, 0.096721597f,
+                        -0.063536644f, -0.132267207f, 0.0764211193f, 0.0745928511f, 0.0407376215f, -0.144591749f, 0.0861372948f, -0.0324451923f,
+                        -0.00791716576f, 0.048569683f, 0.0904373005f, -0.0943489298f, -0.0242348015f, -0.123282939f, -0.0357915349f, 0.175436094f,
+                        0.0318981148f, -0.149505511f, -0.0587347224f, 0.147578046f, -0.0617586635f, 0.0445353612f, -0.0486286171f, 0.214322314f,
+                        0.0439562164f, 0.0203511529f, 0.0613287203f, -0.149974942f, 0.113401398f, -0.0441471264f, -0.0641181692f, -0.158541173f,
+                        -0.11667946f, 0.0240558237f, -0.116763249f, 0.0465020463f, -0.17724362f, -0.0149003156f, -0.162656382f, 0.0665732324f,
+                        0.0839965567f, -0.0738486424f, 0.149312079f, 0.0621671565f, -0.24125725f, -0.231071249f, -0.247340873f, 0.037215855f
+                    }
+                }
+            },
+            {
+                {
+                    {
+                        0.131630316f, -0.0231309105f, 0.247440591f, -0.177226514f, -0.19031626f, 0.133386463f, 0.259911776f, -0.233733058f,
+                        0.161120057f, 0.0753697976f, 0.158422261f, -0.0807741657f, -0.105118327f, -0.291957855f, 0.0440178923f, -0.246913373f,
+                        0.0051035732f, 0.122198693f, -0.140896067f, -0.12725091f, 0.0849364996f, 0.228838071f, 0.150976643f, 0.242862582f,
+                        0.270909131f, 0.150431573f, -0.190200567f, -0.136530235f, 0.136109367f, -0.0445355102f, 0.143860862f, 0.0912053064f,
+                        0.198979303f, -0.0875996947f, 0.0370902866f, -0.0729961544f, -0.139016509f, 0.0625419989f, -0.1833179f, -0.213390008f,
+                        0.12640135f, 0.236938864f, -0.239854231f, 0.274434209f, -0.150469095f, 0.00276668067f, -0.0977822393f, -0.00867088325f,
+                        0.151978746f, -0.189229682f, 0.133339867f, 0.186812863f, 0.0842145532f, -0.315775901f, -0.0199080873f, 0.242410541f,
+                        -0.309672594f, -0.166618809f, -0.236036301f, -0.102531016f, 0.219435662f, 0.0854217634f, 0.0035561109f, -0.0490239188f
+                    },
+                    {
+                        0.111460164f, -0.105495371f, 0.147107825f, 0.0466305688f, -0.00794271473f, -0.121863931f, 0.270386219f, 0.0382917225f,
+                        -0.0700625554f, -0.0897899121f, -0.0187591016f, -0.0763100535f, 0.204990044f, 0.160559431f, 0.088173531f, 0.145704255f,
+                        -0.0997012854f, -0.216010824f, 0.129772499f, 0.13157396f, 0.0746259913f, -0.274490744f, 0.169741377f, -0.0662607849f,
+                        -0.0167562589f, 0.106491223f, 0.205234751f, -0.216912329f, -0.0573507771f, -0.292952865f, -0.0855810791f, 0.267141849f,
+                        0.0485722236f, -0.141497239f, -0.0555885956f, 0.13967301f, -0.0584505536f, 0.0421498194f, -0.0482938401f, 0.223676994f,
+                        0.0481876172f, 0.023414392f, 0.0737694949f, -0.188329399f, 0.149026424f, -0.0606289543f, -0.0919730365f, -0.236748546f,
+                        -0.181296378f, 0.0388662964f, -0.196305141f, 0.0813621953f, -0.322346538f, -0.0280925743f, -0.318439484f, 0.135424957f,
+                        0.177305326f, -0.161605209f, 0.338575363f, 0.062663205f, -0.243182287f, -0.232915014f, -0.249314457f, 0.037512809f
+                    }
+                },
+                {
+                    {
+                        0.0223491583f, -0.00610498898f, 0.167819247f, -0.120198637f, -0.129076362f, 0.110202052f, 0.214735523f, -0.193107024f,
+                        0.133115172f, 0.0622694902f, 0.125283644f, -0.0611230284f, -0.0761134028f, -0.202878356f, 0.0293684192f, -0.158291295f,
+                        0.00314195431f, 0.072247453f, -0.0801306441f, -0.0696023181f, 0.0447281562f, 0.116439939f, 0.0739848763f, 0.11485213f,
+                        0.123530075f, 0.066225104f, -0.0809233114f, -0.0573437586f, 0.0555048361f, -0.0181304906f, 0.0583030134f, 0.0582055375f,
+                        0.126984909f, -0.0925575495f, 0.0391894728f, -0.0771275014f, -0.146884382f, 0.0660816655f, -0.184588671f, -0.204465553f,
+                        0.115301922f, 0.205940813f, -0.199404284f, 0.218543947f, -0.114499196f, 0.00201456551f, -0.0681679994f, -0.00580654899f,
+                        0.097811088f, -0.117121428f, 0.0793111995f, 0.106771708f, 0.0463057309f, -0.167487696f, -0.0101688942f, 0.119166024f,
+                        -0.146704167f, -0.0761397034f, -0.104092248f, -0.101719372f, 0.217698589f, 0.0847455561f, 0.00352796051f, -0.0486358441f
+                    },
+                    {
+                        0.0189245213f, -0.0278436132f, 0.099771522f, 0.0316257998f, -0.00538691087f, -0.100682296f, 0.223389357f, 0.0316360928f,
+                        -0.0578847192f, -0.0741831884f, -0.0148350904f, -0.057744965f, 0.148427874f, 0.111571006f, 0.058828745f, 0.0934081227f,
+                        -0.0613799095f, -0.127711937f, 0.0738044232f, 0.0719669014f, 0.0392985679f, -0.139669433f, 0.0831803828f, -0.0313353837f,
+                        -0.00764057646f, 0.0468810648f, 0.0873197988f, -0.0911048576f, -0.0233874079f, -0.119261667f, -0.0346837528f, 0.170484975f,
+                        0.0309978928f, -0.149505511f, -0.0587347224f, 0.147578046f, -0.0617586635f, 0.0445353612f, -0.0486286171f, 0.214322314f,
+                        0.0439562164f, 0.0203511529f, 0.0613287203f, -0.149974942f, 0.113401398f, -0.0441471264f, -0.0641181692f, -0.158541173f,
+                        -0.11667946f, 0.0240558237f, -0.116763249f, 0.0465020463f, -0.17724362f, -0.0149003156f, -0.162656382f, 0.0665732324f,
+                        0.0839965567f, -0.0738486424f, 0.149312079f, 0.0621671565f, -0.24125725f, -0.231071249f, -0.247340873f, 0.037215855f
+                    }
+                }
+            },
+            {
+                {
+                    {
+                        0.127326757f, -0.0230469201f, 0.247204408f, -0.177057356f, -0.1901346f, 0.125524074f, 0.244591415f, -0.219955787f,
+                        0.151622936f, 0.0709271654f, 0.149596453f, -0.0764554664f, -0.0996828675f, -0.277508497f, 0.0419366173f, -0.235683218f,
+                        0.00488277292f, 0.117044806f, -0.135214105f, -0.122171566f, 0.0816607475f, 0.22063078f, 0.145716593f, 0.234727129f,
+                        0.261965573f, 0.145660847f, -0.184422314f, -0.132446438f, 0.132087171f, -0.0433128625f, 0.140136525f, 0.0878245682f,
+                        0.191603675f, -0.0927515253f, 0.0392716043f, -0.0772891343f, -0.14719221f, 0.0662201568f, -0.193808675f, -0.224873185f,
+                        0.132870689f, 0.248100549f, -0.250716925f, 0.286583185f, -0.156631246f, 0.00287202047f, -0.10125649f, -0.00897101313f,
+                        0.157085359f, -0.195364133f, 0.137548298f, 0.192448318f, 0.0866383836f, -0.324766189f, -0.0204474814f, 0.248427823f,
+                        -0.3168661f, -0.170286119f, -0.240852326f, -0.104032539f, 0.222649202f, 0.0866727307f, 0.00360818882f, -0.0497418568f
+                    },
+                    {
+                        0.107816041f, -0.105112314f, 0.146967411f, 0.046586059f, -0.00793513283f, -0.11468073f, 0.254448444f, 0.0360346362f,
+                        -0.0659327582f, -0.0844972953f, -0.0177140199f, -0.0722300261f, 0.194390416f, 0.152613133f, 0.0840044692f, 0.139077306f,
+                        -0.0953878164f, -0.206900284f, 0.124539107f, 0.126322061f, 0.0717478842f, -0.264646113f, 0.163827553f, -0.0640411675f,
+                        -0.0162030812f, 0.103113994f, 0.198999748f, -0.2104242f, -0.0556559898f, -0.284910321f, -0.0833655149f, 0.25723961f,
+                        0.0467717797f, -0.149818838f, -0.0588578172f, 0.147887319f, -0.0618880913f, 0.0446286947f, -0.0510575622f, 0.23571375f,
+                        0.0506539047f, 0.0245173946f, 0.0771104246f, -0.196666598f, 0.155129492f, -0.0629373714f, -0.095240891f, -0.244943261f,
+                        -0.187388107f, 0.0401262641f, -0.202500865f, 0.0838165879f, -0.33162421f, -0.028892383f, -0.327067345f, 0.138786569f,
+                        0.181424022f, -0.165162176f, 0.345483571f, 0.0635808781f, -0.246743605f, -0.236325964f, -0.252965569f, 0.0380621701f
+                    }
+                },
+                {
+                    {
+                        0.0266527273f, -0.00618897984f, 0.16805543f, -0.120367795f, -0.129258022f, 0.118064433f, 0.230055854f, -0.206884265f,
+                        0.142612293f, 0.0667121112f, 0.134109437f, -0.0654417425f, -0.0815488696f, -0.217327699f, 0.0314496979f, -0.169521436f,
+                        0.00336275506f, 0.0774013475f, -0.0858126134f, -0.074681662f, 0.0480039082f, 0.12464723f, 0.0792449266f, 0.122987591f,
+                        0.132473662f, 0.0709958524f, -0.0867015719f, -0.0614275634f, 0.0595270433f, -0.0193531383f, 0.0620273426f, 0.061586272f,
+                        0.134360537f, -0.0874057189f, 0.0370081551f, -0.0728345215f, -0.138708681f, 0.0624035075f, -0.174097896f, -0.192982391f,
+                        0.10883259f, 0.194779143f, -0.188541591f, 0.206394941f, -0.108337045f, 0.0019092256f, -0.064693749f, -0.00550641818f,
+                        0.0927044675f, -0.110986985f, 0.0751027763f, 0.101136275f, 0.0438819006f, -0.158497408f, -0.00962949917f, 0.113148727f,
+                        -0.139510646f, -0.0724723861f, -0.0992762148f, -0.100217864f, 0.214485079f, 0.0834946036f, 0.00347588304f, -0.0479179136f
+                    },
+                    {
+                        0.0225686394f, -0.0282266773f, 0.0999119282f, 0.0316703096f, -0.00539449183f, -0.107865483f, 0.239327088f, 0.0338931717f,
+                        -0.062014509f, -0.0794757903f, -0.0158801712f, -0.061824996f, 0.159027517f, 0.119517289f, 0.062997818f, 0.100035064f,
+                        -0.0656933859f, -0.136822492f, 0.0790378079f, 0.0772188008f, 0.0421766788f, -0.149514064f, 0.0890941992f, -0.033555001f,
+                        -0.00819375459f, 0.0502582975f, 0.0935547948f, -0.097593002f, -0.025082197f, -0.127304196f, -0.0368993096f, 0.180387214f,
+                        0.032798335f, -0.141183913f, -0.0554655008f, 0.139363736f, -0.0583211258f, 0.042056486f, -0.045864895f, 0.202285573f,
+                        0.041489929f, 0.0192481522f, 0.0579877943f, -0.141637728f, 0.107298329f, -0.041838713f, -0.0608503222f, -0.150346458f,
+                        -0.110587731f, 0.0227958579f, -0.11056754f, 0.0440476574f, -0.167965963f, -0.014100506f, -0.15402849f, 0.0632116124f,
+                        0.0798778534f, -0.0702916756f, 0.142403871f, 0.0612494871f, -0.237695962f, -0.227660328f, -0.24368979f, 0.0366665013f
+                    }
+                }
+            },
+            {
+                {
+                    {
+                        0.149675906f, -0.0284187868f, 0.403653741f, -0.289112419f, -0.310465932f, 0.235726133f, 0.455784082f, -0.409876794f,
+                        0.282541871f, 0.132169291f, 0.272430986f, -0.136384487f, -0.174309805f, -0.476397067f, 0.0707132816f, -0.390789658f,
+                        0.00795765594f, 0.187750533f, -0.21357955f, -0.190241456f, 0.125405014f, 0.333588868f, 0.21734561f, 0.345604539f,
+                        0.381085753f, 0.209321916f, -0.262135953f, -0.187553003f, 0.185436741f, -0.0603078641f, 0.194556415f, 0.143788487f,
+                        0.290161759f, -0.160369575f, 0.0679015368f, -0.133634746f, -0.25449881f, 0.114822716f, -0.329192549f, -0.374865144f,
+                        0.217458919f, 0.39918524f, -0.396944076f, 0.446422517f, -0.24037452f, 0.00434562564f, -0.151122764f, -0.0132118678f,
+                        0.228446588f, -0.280806482f, 0.195309535f, 0.270219743f, 0.120376974f, -0.446413159f, -0.0278354343f, 0.335006624f,
+                        -0.423477978f, -0.225638375f, -0.316554934f, -0.190413862f, 0.40821594f, 0.158985585f, 0.00662589492f, -0.0914695784f
+                    },
+                    {
+                        0.12674056f, -0.129612297f, 0.239979312f, 0.0760691836f, -0.0129570756f, -0.215363026f, 0.474152148f, 0.0671487749f,
+                        -0.122862451f, -0.157456547f, -0.0322591066f, -0.128846973f, 0.339919537f, 0.261989981f, 0.14164786f, 0.230606049f,
+                        -0.155457437f, -0.331886888f, 0.196717709f, 0.196704477f, 0.110182002f, -0.400139093f, 0.24435927f, -0.0942921191f,
+                        -0.0235708989f, 0.148179978f, 0.282856166f, -0.297974706f, -0.0781352594f, -0.396702796f, -0.115739241f, 0.42115885f,
+                        0.0708304942f, -0.259040326f, -0.101766557f, 0.255700678f, -0.107005976f, 0.0773841068f, -0.0867235139f, 0.392936438f,
+                        0.0829012319f, 0.0394476429f, 0.122083999f, -0.306355715f, 0.238069862f, -0.0952299088f, -0.142144635f, -0.36073494f,
+                        -0.272515357f, 0.057675451f, -0.287537873f, 0.117688201f, -0.460764796f, -0.0397145413f, -0.445241243f, 0.187154621f,
+                        0.242465451f, -0.218848854f, 0.454072982f, 0.116373979f, -0.452391773f, -0.433497608f, -0.46453315f, 0.069991976f
+                    }
+                },
+                {
+                    {
+                        0.00430356851f, -0.00081711344f, 0.011606087f, -0.00831272826f, -0.00892669614f, 0.00786238257f, 0.0188632086f, -0.016963277f,
+                        0.0116933575f, 0.00546999555f, 0.0112749049f, -0.00551270926f, -0.00692192744f, -0.0184391476f, 0.0026730299f, -0.014414995f,
+                        0.000287872303f, 0.00669562491f, -0.00744715799f, -0.00661176816f, 0.00425964408f, 0.0116891414f, 0.00761591177f, 0.0121101765f,
+                        0.0133534586f, 0.0073347576f, -0.00898793153f, -0.00632099016f, 0.00617746729f, -0.00235813577f, 0.00760747259f, 0.00562236411f,
+                        0.0358024426f, -0.0197876617f, 0.00837822631f, -0.0164889079f, -0.0314020701f, 0.0138009517f, -0.0387140177f, -0.0429904237f,
+                        0.0242443588f, 0.0436944366f, -0.0423144549f, 0.0465556458f, -0.0245937463f, 0.000435620575f, -0.0148274722f, -0.00126556447f,
+                        0.0213432405f, -0.0255446378f, 0.017341543f, 0.0233648401f, 0.0101433098f, -0.0368504561f, -0.00224154559f, 0.0265699401f,
+                        -0.032898739f, -0.0171201397f, -0.0235735979f, -0.0138365394f, 0.0289183371f, 0.0111817429f, 0.00045817683f, -0.00619019056f
+                    },
+                    {
+                        0.00364411832f, -0.00372668821f, 0.0069000246f, 0.00218718522f, -0.000372549373f, -0.00718319369f, 0.0196233951f, 0.00277903792f,
+                        -0.00508482009f, -0.00651654135f, -0.00133508444f, -0.00520804012f, 0.0134983715f, 0.010140432f, 0.00535442447f, 0.00850632787f,
+                        -0.00562375318f, -0.0118358666f, 0.00685921358f, 0.00683638779f, 0.00374256237f, -0.0140210977f, 0.00856248569f, -0.00330404867f,
+                        -0.000825937488f, 0.00519230962f, 0.0096983714f, -0.010042469f, -0.00260292552f, -0.015511726f, -0.00452559255f, 0.0164679978f,
+                        0.00873962417f, -0.0319624357f, -0.0125567596f, 0.0315503664f, -0.01320324f, 0.00930107199f, -0.0101989415f, 0.045062881f,
+                        0.00924260635f, 0.00431790156f, 0.0130142206f, -0.0319486298f, 0.0243579466f, -0.00954617653f, -0.0139465788f, -0.0345547907f,
+                        -0.0254604835f, 0.00524666859f, -0.0255305041f, 0.0101760365f, -0.0388253666f, -0.00327835069f, -0.0358546078f, 0.0148435486f,
+                        0.0188364163f, -0.0166049898f, 0.0338144563f, 0.00845638663f, -0.0320477895f, -0.0304886699f, -0.0321221985f, 0.00473669684f
+                    }
+                }
+            },
+            {
+                {
+                    {
+                        0.104977593f, -0.0169419311f, 0.0793851614f, -0.0568587221f, -0.0610582419f, 0.015322024f, 0.0298559107f, -0.0268487781f,
+                        0.0185077656f, 0.00865768455f, 0.0243128091f, -0.0153324306f, -0.0235694572f, -0.0746301413f, 0.0125681963f, -0.0773919299f,
+                        0.00174081849f, 0.0447973497f, -0.0550834648f, -0.0525692478f, 0.0369325988f, 0.104190856f, 0.0717317089f, 0.119874999f,
+                        0.138435468f, 0.079435721f, -0.103499003f, -0.0751026794f, 0.0765823349f, -0.025182372f, 0.0818335265f, 0.0296190344f,
+                        0.0646187738f, -0.000193974993f, 8.21302892e-05f, -0.000161637887f, -0.000307829003f, 0.000138488875f, -0.00922000129f, -0.0204076115f,
+                        0.0175687503f, 0.0421596915f, -0.0513126254f, 0.0680392459f, -0.04213202f, 0.000857454725f, -0.0330884792f, -0.00316446344f,
+                        0.0592742451f, -0.0782426819f, 0.0582370758f, 0.0856765807f, 0.0403326452f, -0.157278463f, -0.0102785844f, 0.129261777f,
+                        -0.170161888f, -0.0941464081f, -0.136760056f, -0.00231316034f, 0.00495059835f, 0.00192716555f, 8.02279683e-05f, -0.00110600865f
+                    },
+                    {
+                        0.0888915211f, -0.0772686973f, 0.0471958891f, 0.0149602592f, -0.00254822243f, -0.0139984377f, 0.0310591031f, 0.00439854758f,
+                        -0.00804804452f, -0.0103141135f, -0.00287892926f, -0.0144850584f, 0.0459625311f, 0.0410421304f, 0.0251757242f, 0.0456691906f,
+                        -0.0340079032f, -0.0791883469f, 0.0507346913f, 0.0543551669f, 0.03244932f, -0.124976687f, 0.0806471705f, -0.0327057838f,
+                        -0.00856250431f, 0.0562329218f, 0.111679964f, -0.119319335f, -0.0322685838f, -0.165648669f, -0.0486817695f, 0.0867546424f,
+                        0.0157738887f, -0.000313322176f, -0.000123091726f, 0.00030928271f, -0.000129429056f, 9.33337869e-05f, -0.00242894585f, 0.0213914104f,
+                        0.0066976836f, 0.00416623754f, 0.015781695f, -0.0466916673f, 0.0417280644f, -0.0187902376f, -0.0311227106f, -0.0864020512f,
+                        -0.0707086101f, 0.016070433f, -0.0857375711f, 0.0373145305f, -0.154380545f, -0.0139920646f, -0.164410934f, 0.0722133145f,
+                        0.0974274501f, -0.0913135111f, 0.196171463f, 0.00141371903f, -0.00548633654f, -0.00525470078f, -0.00562468171f, 0.000846311217f
+                    }
+                },
+                {
+                    {
+                        0.0490018874f, -0.0122939683f, 0.335874677f, -0.240566432f, -0.258334368f, 0.228266478f, 0.444791377f, -0.399991304f,
+                        0.275727451f, 0.128981605f, 0.259393066f, -0.126564771f, -0.157662272f, -0.42020607f, 0.0608181134f, -0.327812731f,
+                        0.00650470937f, 0.1496488f, -0.16594325f, -0.14428398f, 0.0927320644f, 0.241087168f, 0.153229803f, 0.237839714f,
+                        0.256003737f, 0.137220964f, -0.167624876f, -0.118771322f, 0.115031876f, -0.0374836288f, 0.120330349f, 0.119791813f,
+                        0.261345446f, -0.179963276f, 0.0761976317f, -0.149962023f, -0.285593063f, 0.128485173f, -0.358686566f, -0.397447944f,
+                        0.22413452f, 0.40072f, -0.38794589f, 0.424938917f, -0.222836256f, 0.00392379146f, -0.132861763f, -0.0113129681f,
+                        0.190515593f, -0.228108451f, 0.154413998f, 0.207908005f, 0.090187639f, -0.325985163f, -0.0197983962f, 0.23231478f,
+                        -0.286214858f, -0.148612112f, -0.203368485f, -0.201937228f, 0.432183653f, 0.16824016f, 0.00700384378f, -0.0965537578f
+                    },
+                    {
+                        0.0414931625f, -0.0560702905f, 0.199683458f, 0.0632961094f, -0.0107814027f, -0.208547786f, 0.46271643f, 0.0655292645f,
+                        -0.119899228f, -0.153658986f, -0.0307152625f, -0.119569957f, 0.307455391f, 0.231088296f, 0.121826552f, 0.193443179f,
+                        -0.127073288f, -0.264534414f, 0.152842239f, 0.149185687f, 0.081475243f, -0.289183497f, 0.17227459f, -0.0648903847f,
+                        -0.0158343315f, 0.097139366f, 0.180874601f, -0.18869786f, -0.0484696031f, -0.246565849f, -0.0715830624f, 0.350872189f,
+                        0.0637962297f, -0.290689439f, -0.114200227f, 0.286941767f, -0.120079786f, 0.0865918472f, -0.0944935083f, 0.416607887f,
+                        0.0854461491f, 0.0395993069f, 0.119316526f, -0.291612685f, 0.220699742f, -0.0859858468f, -0.124968506f, -0.308887661f,
+                        -0.227267221f, 0.0468516871f, -0.227330819f, 0.0905497074f, -0.345209628f, -0.0290008262f, -0.316684902f, 0.129784852f,
+                        0.163874432f, -0.144140333f, 0.29171598f, 0.123416647f, -0.478953212f, -0.458731592f, -0.491030663f, 0.0738823563f
+                    }
+                }
+            }
+        };
+
+    } /* namespace ringmod_sc_test */
+} /* namespace lsp */
+
+#endif /* TEST_UTEST_RINGMOD_SC_GOLDEN_H_ */
@@ -0,0 +1,469 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-ringmod-sc
+ * Created on: 16 окт 2026 г.
+ *
+ * lsp-plugins-ringmod-sc is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-ringmod-sc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-ringmod-sc. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+
+#include "../helpers/ringmod_sc.h"
+#include "ringmod_sc_golden.h"
+
+#include <type_traits>
+
+// Maximum size of the host block
+#define BLOCK_SIZE          1024
+// Number of samples rendered for each combination of parameters
+#define SIGNAL_SIZE         4096
+// Number of silent samples processed before the test signal
+#define WARMUP_SIZE         8192
+// Absolute tolerance of the vectorized kernels against the scalar reference
+#define TOLERANCE           1e-5f
+// Absolute tolerance between the backends for the modes which have no scalar reference
+#define BACKEND_TOLERANCE   1e-4f
+// Maximum number of parameters of the extended configuration
+#define PARAMS_MAX          8
+
+// DSP functions called by the plugin directly
+#define RMOD_DSP_FUNCTIONS(X) \
+    X(abs1) X(abs_max) X(abs_min) X(add2) X(add3) X(axis_apply_log1) X(copy) \
+    X(fill) X(fill_one) X(fill_zero) X(fmadd3) X(h_sum) X(lr_to_mid) X(lr_to_ms) \
+    X(lr_to_side) X(lramp1) X(lramp2) X(minmax) X(mix2) X(mix_copy2) X(mix_copy3) \
+    X(move) X(mul2) X(mul3) X(mul_k2) X(mul_k3) X(pamax3) X(pamin3) X(pmax2) \
+    X(pmax3) X(pmin2) X(sqr1) X(ssqrt1) X(sub2)
+
+#define RMOD_DSP_DECLARE(name)      extern std::remove_pointer<decltype(::lsp::dsp::name)>::type name;
+#define RMOD_DSP_FIELD(name)        decltype(::lsp::dsp::name) name;
+#define RMOD_DSP_SAVE(name)         b->name = ::lsp::dsp::name;
+#define RMOD_DSP_LOAD(name)         ::lsp::dsp::name = b->name;
+#define RMOD_DSP_GENERIC(name)      b->name = ::lsp::generic::name;
+
+namespace lsp
+{
+    // Portable implementations of the functions, always present in lsp-dsp-lib
+    namespace generic
+    {
+        RMOD_DSP_FUNCTIONS(RMOD_DSP_DECLARE)
+    } /* namespace generic */
+} /* namespace lsp */
+
+namespace
+{
+    using namespace lsp;
+    using namespace lsp::ringmod_sc_test;
+
+    // Host block sizes, cycled while rendering the signal
+    static const size_t block_sizes[] =
+    {
+        1, 7, 64, 333, 1024, 2, 513, 31, 256, 1000
+    };
+
+    // Set of DSP functions used by the plugin
+    typedef struct backend_t
+    {
+        RMOD_DSP_FUNCTIONS(RMOD_DSP_FIELD)
+    } backend_t;
+
+    static void save_backend(backend_t *b)
+    {
+        RMOD_DSP_FUNCTIONS(RMOD_DSP_SAVE)
+    }
+
+    static void load_backend(const backend_t *b)
+    {
+        RMOD_DSP_FUNCTIONS(RMOD_DSP_LOAD)
+    }
+
+    static void generic_backend(backend_t *b)
+    {
+        RMOD_DSP_FUNCTIONS(RMOD_DSP_GENERIC)
+    }
+
+    typedef struct param_t
+    {
+        const char         *id;
+        float               value;
+    } param_t;
+
+    // Configuration of the plugin which is only checked for consistency between the backends
+    typedef struct ext_config_t
+    {
+        const char         *sName;
+        size_t              nMeta;          // 0 = stereo, 1 = 5.1
+        param_t             vParams[PARAMS_MAX];
+        param_t             sRamp;          // Parameter changed on each host block up to the value
+    } ext_config_t;
+
+    static const ext_config_t ext_configs[] =
+    {
+        { "lookahead taps",     0, { { "lk", 5.0f }, { "duck", 2.0f }, { "lkmode", 0.0f } }, { NULL, 0.0f } },
+        { "lookahead window",   0, { { "lk", 5.0f }, { "duck", 2.0f }, { "lkmode", 1.0f } }, { NULL, 0.0f } },
+        { "detector rms",       0, { { "detect", 1.0f }, { "dwin", 5.0f } }, { NULL, 0.0f } },
+        { "detector mean",      0, { { "detect", 2.0f }, { "dwin", 5.0f } }, { NULL, 0.0f } },
+        { "filters",            0, { { "shpm", 2.0f }, { "shpf", 200.0f }, { "slpm", 3.0f }, { "slpf", 4000.0f } }, { NULL, 0.0f } },
+        { "bands 2",            0, { { "bands", 1.0f }, { "sf1", 500.0f } }, { NULL, 0.0f } },
+        { "bands 4 rms",        0, { { "bands", 3.0f }, { "detect", 1.0f }, { "lk", 3.0f } }, { NULL, 0.0f } },
+        { "surround",           1, { { "detect", 1.0f }, { "lk", 3.0f }, { "ovs", 1.0f } }, { NULL, 0.0f } },
+        { "oversampling 2x",    0, { { "ovs", 1.0f } }, { NULL, 0.0f } },
+        { "oversampling 8x",    0, { { "ovs", 3.0f }, { "lk", 2.0f } }, { NULL, 0.0f } },
+        { "ramp amount",        0, { { "amount", -6.0f } }, { "amount", 12.0f } },
+        { "ramp wet",           0, { { "dry", 0.5f }, { "wet", 0.0f } }, { "wet", 2.0f } },
+        { "ramp input",         1, { { "g_in", 0.25f } }, { "g_in", 4.0f } },
+        { "ramp sidechain",     0, { { "g_sc", 4.0f }, { "ovs", 2.0f } }, { "g_sc", 0.25f } }
+    };
+
+    typedef struct signal_t
+    {
+        float              *vIn[REF_CHANNELS_MAX];
+        float              *vSc[REF_CHANNELS_MAX];
+        float              *vOut[REF_CHANNELS_MAX];
+        float              *vRef[REF_CHANNELS_MAX];
+        uint8_t            *pData;
+    } signal_t;
+}
+
+UTEST_BEGIN("plugins.ringmod_sc", kernels)
+
+    bool alloc_signal(signal_t *s, size_t channels, size_t count)
+    {
+        const size_t buf_sz     = align_size(sizeof(float) * count, OPTIMAL_ALIGN);
+        uint8_t *ptr            = alloc_aligned<uint8_t>(s->pData, buf_sz * channels * 4, OPTIMAL_ALIGN);
+        if (ptr == NULL)
+            return false;
+
+        for (size_t i=0; i<channels; ++i)
+        {
+            s->vIn[i]               = advance_ptr_bytes<float>(ptr, buf_sz);
+            s->vSc[i]               = advance_ptr_bytes<float>(ptr, buf_sz);
+            s->vOut[i]              = advance_ptr_bytes<float>(ptr, buf_sz);
+            s->vRef[i]              = advance_ptr_bytes<float>(ptr, buf_sz);
+        }
+
+        return true;
+    }
+
+    void free_signal(signal_t *s)
+    {
+        free_aligned(s->pData);
+        s->pData                = NULL;
+    }
+
+    void compare(const char *label, const float *a, const float *b, size_t count, float tolerance = TOLERANCE)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            const float d = fabsf(a[i] - b[i]);
+            UTEST_ASSERT_MSG((isfinite(a[i])) && (d <= tolerance),
+                "%s: sample %d differs: %.9g vs %.9g (diff=%.9g)",
+                label, int(i), a[i], b[i], d);
+        }
+    }
+
+    void init_config(ref_config_t *cfg, size_t channels, size_t type, size_t source, bool invert)
+    {
+        cfg->nChannels          = channels;
+        cfg->nType              = type;
+        cfg->nSource            = source;
+        cfg->bInvert            = invert;
+        cfg->bOutIn             = true;
+        cfg->bOutSc             = false;
+        cfg->bActive            = true;
+        cfg->fSampleRate        = GOLDEN_SAMPLE_RATE;
+        cfg->fHold              = GOLDEN_HOLD;
+        cfg->fRelease           = GOLDEN_RELEASE;
+        cfg->fStereoLink        = GOLDEN_STEREO_LINK;
+    }
+
+    /**
+     * Check that the scalar reference still produces the golden data
+     */
+    void test_golden()
+    {
+        signal_t s;
+        UTEST_ASSERT(alloc_signal(&s, 2, GOLDEN_SAMPLES));
+
+        ref_config_t cfg;
+        char label[80];
+
+        for (size_t inv=0; inv<2; ++inv)
+        {
+            uint32_t seed           = GOLDEN_SEED;
+            ref_signals(s.vIn, s.vSc, 1, GOLDEN_SAMPLES, seed);
+            init_config(&cfg, 1, REF_TYPE_EXTERNAL, REF_SRC_LEFT_RIGHT, inv);
+            ref_process(s.vRef, s.vIn, s.vSc, &cfg, GOLDEN_SAMPLES);
+
+            snprintf(label, sizeof(label), "golden mono invert=%d", int(inv));
+            compare(label, s.vRef[0], golden_mono[inv], GOLDEN_SAMPLES);
+        }
+
+        for (size_t src=0; src<REF_SRC_TOTAL; ++src)
+            for (size_t inv=0; inv<2; ++inv)
+            {
+                uint32_t seed           = GOLDEN_SEED;
+                ref_signals(s.vIn, s.vSc, 2, GOLDEN_SAMPLES, seed);
+                init_config(&cfg, 2, REF_TYPE_EXTERNAL, src, inv);
+                ref_process(s.vRef, s.vIn, s.vSc, &cfg, GOLDEN_SAMPLES);
+
+                for (size_t c=0; c<2; ++c)
+                {
+                    snprintf(label, sizeof(label), "golden stereo source=%d invert=%d channel=%d",
+                        int(src), int(inv), int(c));
+                    compare(label, s.vRef[c], golden_stereo[src][inv][c], GOLDEN_SAMPLES);
+                }
+            }
+
+        free_signal(&s);
+    }
+
+    /**
+     * Render the signal through the plugin in host blocks of varying size and
+     * compare the result with the scalar reference
+     */
+    void test_plugin(const meta::plugin_t *meta, signal_t *s, const ref_config_t *cfg, uint32_t & seed)
+    {
+        const size_t channels   = cfg->nChannels;
+
+        printf("Testing channels=%d type=%d source=%d invert=%d out_in=%d out_sc=%d active=%d...\n",
+            int(channels), int(cfg->nType), int(cfg->nSource), int(cfg->bInvert),
+            int(cfg->bOutIn), int(cfg->bOutSc), int(cfg->bActive));
+
+        Harness h;
+        UTEST_ASSERT(h.init(meta, channels, true, BLOCK_SIZE));
+        Plugin *p               = h.plugin();
+
+        h.set("type", cfg->nType);
+        h.set("invert", (cfg->bInvert) ? 1.0f : 0.0f);
+        h.set("out_in", (cfg->bOutIn) ? 1.0f : 0.0f);
+        h.set("out_sc", (cfg->bOutSc) ? 1.0f : 0.0f);
+        h.set("active", (cfg->bActive) ? 1.0f : 0.0f);
+        h.set("hold", cfg->fHold);
+        h.set("release", cfg->fRelease);
+        if (channels == 2)
+        {
+            h.set("source", cfg->nSource);
+            h.set("slink", cfg->fStereoLink);
+        }
+        h.set_sample_rate(cfg->fSampleRate);
+        h.update_settings();
+
+        // Let the bypass switch and the envelope settle on silence
+        for (size_t offset=0; offset < WARMUP_SIZE; offset += BLOCK_SIZE)
+            h.process(BLOCK_SIZE);
+
+        // Render the signal
+        ref_signals(s->vIn, s->vSc, channels, SIGNAL_SIZE, seed);
+        for (size_t offset=0, k=0; offset < SIGNAL_SIZE; ++k)
+        {
+            const size_t count  = lsp_min(block_sizes[k % (sizeof(block_sizes)/sizeof(block_sizes[0]))], SIGNAL_SIZE - offset);
+            for (size_t i=0; i<channels; ++i)
+            {
+                dsp::copy(p->in_buffer(i), &s->vIn[i][offset], count);
+                float *sc           = p->sc_buffer(i);
+                if (sc != NULL)
+                    dsp::copy(sc, &s->vSc[i][offset], count);
+            }
+
+            h.process(count);
+
+            for (size_t i=0; i<channels; ++i)
+                dsp::copy(&s->vOut[i][offset], p->out_buffer(i), count);
+
+            // Meters are updated on each block even when there is no UI to show the graphs,
+            // the output meter is taken before the bypass switch
+            if (cfg->bActive)
+            {
+                const char *meter_id    = (channels > 1) ? "olm_l" : "olm";
+                const float meter       = h.port(meter_id)->value();
+                const float peak        = dsp::abs_max(&s->vOut[0][offset], count);
+                UTEST_ASSERT_MSG(fabsf(meter - peak) <= TOLERANCE,
+                    "Output meter %s differs from the block peak: %.9g vs %.9g", meter_id, meter, peak);
+            }
+            offset     += count;
+        }
+
+        // Compare with the reference
+        ref_process(s->vRef, s->vIn, s->vSc, cfg, SIGNAL_SIZE);
+
+        char label[160];
+        for (size_t i=0; i<channels; ++i)
+        {
+            snprintf(label, sizeof(label),
+                "channels=%d type=%d source=%d invert=%d out_in=%d out_sc=%d active=%d channel=%d",
+                int(channels), int(cfg->nType), int(cfg->nSource), int(cfg->bInvert),
+                int(cfg->bOutIn), int(cfg->bOutSc), int(cfg->bActive), int(i));
+            compare(label, s->vOut[i], s->vRef[i], SIGNAL_SIZE);
+        }
+    }
+
+    /**
+     * Test all combinations of the sidechain type, the inversion and output modes
+     */
+    void test_modes(const meta::plugin_t *meta, size_t channels, size_t types, size_t sources, uint32_t & seed)
+    {
+        signal_t s;
+        UTEST_ASSERT(alloc_signal(&s, channels, SIGNAL_SIZE));
+
+        ref_config_t cfg;
+        for (size_t type=0; type<types; ++type)
+            for (size_t src=0; src<sources; ++src)
+                for (size_t mode=0; mode<16; ++mode)
+                {
+                    init_config(&cfg, channels, type, src, mode & 1);
+                    cfg.bOutIn              = mode & 2;
+                    cfg.bOutSc              = mode & 4;
+                    cfg.bActive             = mode & 8;
+                    if (channels != 2)
+                        cfg.fStereoLink         = 0.0f;
+
+                    test_plugin(meta, &s, &cfg, seed);
+                }
+
+        free_signal(&s);
+    }
+
+    /**
+     * Render the signal through the plugin with the extended configuration
+     */
+    void render_extended(const ext_config_t *cfg, signal_t *s, float **dst, uint32_t seed)
+    {
+        const meta::plugin_t *meta  = (cfg->nMeta > 0) ? &meta::ringmod_sc_5_1 : &meta::ringmod_sc_stereo;
+        const size_t channels       = (cfg->nMeta > 0) ? 6 : 2;
+
+        Harness h;
+        UTEST_ASSERT(h.init(meta, channels, true, BLOCK_SIZE));
+        Plugin *p               = h.plugin();
+
+        h.set("type", REF_TYPE_EXTERNAL);
+        h.set("hold", GOLDEN_HOLD);
+        h.set("release", GOLDEN_RELEASE);
+        h.set("slink", GOLDEN_STEREO_LINK);
+        for (size_t i=0; (i < PARAMS_MAX) && (cfg->vParams[i].id != NULL); ++i)
+            h.set(cfg->vParams[i].id, cfg->vParams[i].value);
+
+        float ramp_start        = 0.0f;
+        if (cfg->sRamp.id != NULL)
+            ramp_start              = h.port(cfg->sRamp.id)->value();
+
+        h.set_sample_rate(GOLDEN_SAMPLE_RATE);
+        h.update_settings();
+
+        for (size_t offset=0; offset < WARMUP_SIZE; offset += BLOCK_SIZE)
+            h.process(BLOCK_SIZE);
+
+        ref_signals(s->vIn, s->vSc, channels, SIGNAL_SIZE, seed);
+        for (size_t offset=0, k=0; offset < SIGNAL_SIZE; ++k)
+        {
+            const size_t count  = lsp_min(block_sizes[k % (sizeof(block_sizes)/sizeof(block_sizes[0]))], SIGNAL_SIZE - offset);
+            if (cfg->sRamp.id != NULL)
+            {
+                const float t       = float(offset + count) / float(SIGNAL_SIZE);
+                h.set(cfg->sRamp.id, ramp_start + (cfg->sRamp.value - ramp_start) * t);
+                h.update_settings();
+            }
+
+            for (size_t i=0; i<channels; ++i)
+            {
+                dsp::copy(p->in_buffer(i), &s->vIn[i][offset], count);
+                float *sc           = p->sc_buffer(i);
+                if (sc != NULL)
+                    dsp::copy(sc, &s->vSc[i][offset], count);
+            }
+
+            h.process(count);
+
+            for (size_t i=0; i<channels; ++i)
+                dsp::copy(&dst[i][offset], p->out_buffer(i), count);
+            offset     += count;
+        }
+    }
+
+    /**
+     * Test the modes which have no scalar reference: the generic backend should
+     * produce the same output as the native one
+     */
+    void test_extended(const backend_t *native, const backend_t *generic, uint32_t & seed)
+    {
+        signal_t s;
+        UTEST_ASSERT(alloc_signal(&s, 6, SIGNAL_SIZE));
+
+        char label[160];
+        for (size_t i=0; i<sizeof(ext_configs)/sizeof(ext_configs[0]); ++i)
+        {
+            const ext_config_t *cfg = &ext_configs[i];
+            const size_t channels   = (cfg->nMeta > 0) ? 6 : 2;
+            printf("Testing extended configuration '%s'...\n", cfg->sName);
+
+            load_backend(native);
+            render_extended(cfg, &s, s.vOut, seed);
+            load_backend(generic);
+            render_extended(cfg, &s, s.vRef, seed);
+            load_backend(native);
+
+            for (size_t c=0; c<channels; ++c)
+            {
+                snprintf(label, sizeof(label), "extended '%s' channel=%d", cfg->sName, int(c));
+                compare(label, s.vRef[c], s.vOut[c], SIGNAL_SIZE, BACKEND_TOLERANCE);
+            }
+
+            seed                    = seed * 1103515245u + 12345u;
+        }
+
+        free_signal(&s);
+    }
+
+    UTEST_MAIN
+    {
+        backend_t native, generic;
+        save_backend(&native);
+        generic_backend(&generic);
+
+        struct backend_ref_t
+        {
+            const char         *name;
+            const backend_t    *backend;
+        };
+        const backend_ref_t backends[] =
+        {
+            { "native",     &native     },
+            { "generic",    &generic    }
+        };
+
+        test_golden();
+
+        for (size_t i=0; i<sizeof(backends)/sizeof(backends[0]); ++i)
+        {
+            printf("Testing %s backend...\n", backends[i].name);
+            uint32_t seed = 0x1234;
+            load_backend(backends[i].backend);
+
+            // Mono: generic envelope follower
+            test_modes(&meta::ringmod_sc_mono, 1, REF_TYPE_TOTAL, 1, seed);
+            // Stereo: fused front-end for each sidechain source
+            test_modes(&meta::ringmod_sc_stereo, 2, REF_TYPE_TOTAL, REF_SRC_TOTAL, seed);
+            // Surround: envelope follower over channel pairs, only internal and external sidechain
+            test_modes(&meta::ringmod_sc_5_1, 6, REF_TYPE_SHM_LINK, 1, seed);
+        }
+        load_backend(&native);
+
+        // Lookahead, detectors, filters, bands, oversampling and ramps against the native backend
+        uint32_t seed = 0x5678;
+        test_extended(&native, &generic, seed);
+    }
+
+UTEST_END